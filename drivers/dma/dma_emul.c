@@ -0,0 +1,329 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Emulated DMA controller. Memory to memory transfers, including block
+ * chains, are done in software by a work queue, so that they complete
+ * asynchronously and report through the callback like a real controller.
+ */
+
+#define DT_DRV_COMPAT zephyr_dma_emul
+
+#include <device.h>
+#include <drivers/dma.h>
+#include <string.h>
+
+#include <logging/log.h>
+LOG_MODULE_REGISTER(dma_emul, CONFIG_DMA_LOG_LEVEL);
+
+struct dma_emul_channel {
+	const struct device *dev;
+	struct k_work work;
+	struct dma_config cfg;
+	uint32_t id;
+	/* Bytes left in the transfer */
+	uint32_t pending;
+	bool configured;
+	bool busy;
+	bool stop;
+};
+
+struct dma_emul_config {
+	struct dma_emul_channel *channels;
+	uint32_t num_channels;
+};
+
+struct dma_emul_data {
+	struct dma_context ctx;
+	atomic_t *channels_atomic;
+};
+
+static K_KERNEL_STACK_DEFINE(dma_emul_stack, CONFIG_DMA_EMUL_WORKQ_STACK_SIZE);
+static struct k_work_q dma_emul_workq;
+
+static inline void *addr_to_ptr(uintptr_t addr)
+{
+	return (void *)addr;
+}
+
+/* Copy one block, one data unit at a time unless both sides increment */
+static int block_copy(const struct dma_config *cfg,
+		      const struct dma_block_config *block)
+{
+	uint8_t *src = addr_to_ptr(block->source_address);
+	uint8_t *dst = addr_to_ptr(block->dest_address);
+	uint32_t unit = cfg->source_data_size;
+	uint32_t i;
+
+	if (block->source_gather_en || block->dest_scatter_en) {
+		return -ENOTSUP;
+	}
+
+	if (block->source_addr_adj == DMA_ADDR_ADJ_INCREMENT &&
+	    block->dest_addr_adj == DMA_ADDR_ADJ_INCREMENT) {
+		memcpy(dst, src, block->block_size);
+		return 0;
+	}
+
+	if (block->source_addr_adj == DMA_ADDR_ADJ_NO_CHANGE &&
+	    block->dest_addr_adj == DMA_ADDR_ADJ_INCREMENT && unit == 1U) {
+		memset(dst, *src, block->block_size);
+		return 0;
+	}
+
+	for (i = 0U; i + unit <= block->block_size; i += unit) {
+		memcpy(dst, src, unit);
+
+		if (block->source_addr_adj == DMA_ADDR_ADJ_INCREMENT) {
+			src += unit;
+		} else if (block->source_addr_adj == DMA_ADDR_ADJ_DECREMENT) {
+			src -= unit;
+		}
+
+		if (block->dest_addr_adj == DMA_ADDR_ADJ_INCREMENT) {
+			dst += unit;
+		} else if (block->dest_addr_adj == DMA_ADDR_ADJ_DECREMENT) {
+			dst -= unit;
+		}
+	}
+
+	return 0;
+}
+
+static void dma_emul_work(struct k_work *work)
+{
+	struct dma_emul_channel *chan =
+		CONTAINER_OF(work, struct dma_emul_channel, work);
+	const struct dma_config *cfg = &chan->cfg;
+	struct dma_block_config *block = cfg->head_block;
+	uint32_t count = 0U;
+	int err = 0;
+
+	while (block && count < cfg->block_count && !chan->stop) {
+		err = block_copy(cfg, block);
+		if (err) {
+			break;
+		}
+
+		chan->pending -= MIN(chan->pending, block->block_size);
+		block = block->next_block;
+		count++;
+
+		if (cfg->complete_callback_en && cfg->dma_callback &&
+		    count < cfg->block_count && block) {
+			cfg->dma_callback(chan->dev, cfg->user_data, chan->id,
+					  0);
+		}
+	}
+
+	chan->busy = false;
+
+	if (!cfg->dma_callback || (chan->stop && !err)) {
+		return;
+	}
+
+	/* error_callback_en set means no callback on error */
+	if (err && cfg->error_callback_en) {
+		return;
+	}
+
+	cfg->dma_callback(chan->dev, cfg->user_data, chan->id,
+			  err ? -EIO : 0);
+}
+
+static struct dma_emul_channel *get_channel(const struct device *dev,
+					    uint32_t channel)
+{
+	const struct dma_emul_config *config = dev->config;
+
+	if (channel >= config->num_channels) {
+		return NULL;
+	}
+
+	return &config->channels[channel];
+}
+
+static int dma_emul_configure(const struct device *dev, uint32_t channel,
+			      struct dma_config *cfg)
+{
+	struct dma_emul_channel *chan = get_channel(dev, channel);
+
+	if (!chan) {
+		return -EINVAL;
+	}
+
+	if (chan->busy) {
+		return -EBUSY;
+	}
+
+	if (cfg->channel_direction != MEMORY_TO_MEMORY) {
+		LOG_ERR("Only memory to memory transfers are supported");
+		return -ENOTSUP;
+	}
+
+	if (cfg->source_data_size != cfg->dest_data_size ||
+	    !cfg->source_data_size || !cfg->head_block ||
+	    !cfg->block_count) {
+		return -EINVAL;
+	}
+
+	/* The blocks are used in place and must stay valid until the end
+	 * of the transfer, as descriptors of a real controller.
+	 */
+	chan->cfg = *cfg;
+	chan->configured = true;
+
+	return 0;
+}
+
+static int dma_emul_reload(const struct device *dev, uint32_t channel,
+#ifdef CONFIG_DMA_64BIT
+			   uint64_t src, uint64_t dst,
+#else
+			   uint32_t src, uint32_t dst,
+#endif
+			   size_t size)
+{
+	struct dma_emul_channel *chan = get_channel(dev, channel);
+
+	if (!chan || !chan->configured) {
+		return -EINVAL;
+	}
+
+	if (chan->busy) {
+		return -EBUSY;
+	}
+
+	chan->cfg.head_block->source_address = src;
+	chan->cfg.head_block->dest_address = dst;
+	chan->cfg.head_block->block_size = size;
+
+	return 0;
+}
+
+static int dma_emul_start(const struct device *dev, uint32_t channel)
+{
+	struct dma_emul_channel *chan = get_channel(dev, channel);
+	struct dma_block_config *block;
+	uint32_t i;
+
+	if (!chan || !chan->configured) {
+		return -EINVAL;
+	}
+
+	if (chan->busy) {
+		return -EBUSY;
+	}
+
+	chan->pending = 0U;
+	block = chan->cfg.head_block;
+	for (i = 0U; block && i < chan->cfg.block_count; i++) {
+		chan->pending += block->block_size;
+		block = block->next_block;
+	}
+
+	chan->stop = false;
+	chan->busy = true;
+	k_work_submit_to_queue(&dma_emul_workq, &chan->work);
+
+	return 0;
+}
+
+static int dma_emul_stop(const struct device *dev, uint32_t channel)
+{
+	struct dma_emul_channel *chan = get_channel(dev, channel);
+
+	if (!chan) {
+		return -EINVAL;
+	}
+
+	/* The block being copied is completed */
+	chan->stop = true;
+
+	return 0;
+}
+
+static int dma_emul_get_status(const struct device *dev, uint32_t channel,
+			       struct dma_status *status)
+{
+	struct dma_emul_channel *chan = get_channel(dev, channel);
+
+	if (!chan) {
+		return -EINVAL;
+	}
+
+	status->busy = chan->busy;
+	status->dir = MEMORY_TO_MEMORY;
+	status->pending_length = chan->pending;
+
+	return 0;
+}
+
+static const struct dma_driver_api dma_emul_api = {
+	.config = dma_emul_configure,
+	.reload = dma_emul_reload,
+	.start = dma_emul_start,
+	.stop = dma_emul_stop,
+	.get_status = dma_emul_get_status,
+};
+
+static int dma_emul_workq_init(const struct device *dev)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "dma_emul",
+	};
+
+	ARG_UNUSED(dev);
+
+	k_work_queue_start(&dma_emul_workq, dma_emul_stack,
+			   K_KERNEL_STACK_SIZEOF(dma_emul_stack),
+			   CONFIG_DMA_EMUL_WORKQ_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(dma_emul_workq_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE);
+
+static int dma_emul_init(const struct device *dev)
+{
+	const struct dma_emul_config *config = dev->config;
+	struct dma_emul_data *data = dev->data;
+	uint32_t i;
+
+	for (i = 0U; i < config->num_channels; i++) {
+		struct dma_emul_channel *chan = &config->channels[i];
+
+		chan->dev = dev;
+		chan->id = i;
+		k_work_init(&chan->work, dma_emul_work);
+	}
+
+	data->ctx.magic = DMA_MAGIC;
+	data->ctx.dma_channels = config->num_channels;
+	data->ctx.atomic = data->channels_atomic;
+
+	return 0;
+}
+
+#define DMA_EMUL_INIT(n)						\
+	static struct dma_emul_channel					\
+		dma_emul_channels_##n[DT_INST_PROP(n, dma_channels)];	\
+	static ATOMIC_DEFINE(dma_emul_atomic_##n,			\
+			     DT_INST_PROP(n, dma_channels));		\
+	static const struct dma_emul_config dma_emul_config_##n = {	\
+		.channels = dma_emul_channels_##n,			\
+		.num_channels = DT_INST_PROP(n, dma_channels),		\
+	};								\
+	static struct dma_emul_data dma_emul_data_##n = {		\
+		.channels_atomic = dma_emul_atomic_##n,			\
+	};								\
+	DEVICE_DT_INST_DEFINE(n, dma_emul_init, NULL,			\
+			      &dma_emul_data_##n, &dma_emul_config_##n,	\
+			      POST_KERNEL,				\
+			      CONFIG_KERNEL_INIT_PRIORITY_DEVICE,	\
+			      &dma_emul_api);
+
+DT_INST_FOREACH_STATUS_OKAY(DMA_EMUL_INIT)
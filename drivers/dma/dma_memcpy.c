@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Memory copy offload. Operations are queued and done one at a time, each
+ * one split in parts of equal size, one per DMA channel, so that the
+ * channels run in parallel. The operation completes when the last part
+ * does.
+ */
+
+#include <kernel.h>
+#include <device.h>
+#include <cache.h>
+#include <string.h>
+#include <drivers/dma.h>
+#include <drivers/dma/dma_memcpy.h>
+
+#include <logging/log.h>
+LOG_MODULE_REGISTER(dma_memcpy, CONFIG_DMA_LOG_LEVEL);
+
+#define DMA_MEMCPY_NODE DT_CHOSEN(zephyr_dma_memcpy)
+
+/* Parts are aligned so that word transfers can be used */
+#define PART_ALIGN 4U
+
+struct dma_memcpy_chan {
+	struct dma_config cfg;
+	struct dma_block_config block;
+	uint32_t id;
+};
+
+static const struct device *dma_dev = DEVICE_DT_GET(DMA_MEMCPY_NODE);
+
+static struct dma_memcpy_chan chans[CONFIG_DMA_MEMCPY_CHANNELS];
+static uint32_t num_chans;
+
+static sys_slist_t queue;
+static struct k_spinlock lock;
+
+static void op_cpu(struct dma_memcpy_op *op)
+{
+	if (op->src) {
+		memcpy(op->dst, op->src, op->len);
+	} else {
+		memset(op->dst, op->value, op->len);
+	}
+}
+
+static void start(struct dma_memcpy_op *op);
+
+static void complete(struct dma_memcpy_op *op)
+{
+	struct dma_memcpy_op *next;
+	k_spinlock_key_t key;
+
+	/* Lines of the destination may have been loaded during the transfer */
+	sys_cache_data_range(op->dst, op->len, K_CACHE_INVD);
+
+	key = k_spin_lock(&lock);
+	sys_slist_get(&queue);
+	next = SYS_SLIST_PEEK_HEAD_CONTAINER(&queue, next, node);
+	k_spin_unlock(&lock, key);
+
+	op->cb(op, op->status, op->user_data);
+
+	if (next) {
+		start(next);
+	}
+}
+
+static void part_done(const struct device *dev, void *user_data,
+		      uint32_t channel, int status)
+{
+	struct dma_memcpy_op *op = SYS_SLIST_PEEK_HEAD_CONTAINER(&queue, op,
+								   node);
+
+	ARG_UNUSED(dev);
+	ARG_UNUSED(user_data);
+	ARG_UNUSED(channel);
+
+	if (status < 0) {
+		op->status = status;
+	}
+
+	if (atomic_dec(&op->pending) == 1) {
+		complete(op);
+	}
+}
+
+static int part_start(struct dma_memcpy_chan *chan, struct dma_memcpy_op *op,
+		      size_t offset, size_t len)
+{
+	uint8_t *dst = (uint8_t *)op->dst + offset;
+	uint32_t unit = 1U;
+	int err;
+
+	memset(&chan->block, 0, sizeof(chan->block));
+	chan->block.dest_address = (uintptr_t)dst;
+	chan->block.block_size = len;
+
+	if (op->src) {
+		const uint8_t *src = (const uint8_t *)op->src + offset;
+
+		chan->block.source_address = (uintptr_t)src;
+		if ((((uintptr_t)src | (uintptr_t)dst | len) &
+		     (PART_ALIGN - 1)) == 0U) {
+			unit = PART_ALIGN;
+		}
+	} else {
+		chan->block.source_address = (uintptr_t)&op->value;
+		chan->block.source_addr_adj = DMA_ADDR_ADJ_NO_CHANGE;
+	}
+
+	memset(&chan->cfg, 0, sizeof(chan->cfg));
+	chan->cfg.channel_direction = MEMORY_TO_MEMORY;
+	chan->cfg.source_data_size = unit;
+	chan->cfg.dest_data_size = unit;
+	chan->cfg.source_burst_length = unit;
+	chan->cfg.dest_burst_length = unit;
+	chan->cfg.block_count = 1U;
+	chan->cfg.head_block = &chan->block;
+	chan->cfg.dma_callback = part_done;
+	chan->cfg.user_data = chan;
+
+	err = dma_config(dma_dev, chan->id, &chan->cfg);
+	if (!err) {
+		err = dma_start(dma_dev, chan->id);
+	}
+
+	return err;
+}
+
+static void start(struct dma_memcpy_op *op)
+{
+	uint32_t parts = MIN(num_chans, op->len / CONFIG_DMA_MEMCPY_THRESHOLD);
+	size_t part_len, offset = 0U;
+	uint32_t i;
+	int err = 0;
+
+	parts = MAX(parts, 1U);
+	part_len = ROUND_UP(op->len / parts, PART_ALIGN);
+
+	if (op->src) {
+		sys_cache_data_range((void *)op->src, op->len, K_CACHE_WB);
+	}
+	sys_cache_data_range(op->dst, op->len, K_CACHE_WB_INVD);
+
+	/* One more than the parts, so that the operation does not complete
+	 * before all of them are started.
+	 */
+	op->status = 0;
+	atomic_set(&op->pending, parts + 1U);
+
+	for (i = 0U; i < parts && offset < op->len; i++) {
+		size_t len = MIN(part_len, op->len - offset);
+
+		err = part_start(&chans[i], op, offset, len);
+		if (err) {
+			LOG_ERR("Channel %u failed to start (err %d)",
+				chans[i].id, err);
+			op->status = err;
+			break;
+		}
+
+		offset += len;
+	}
+
+	/* Drop the parts not started */
+	if (atomic_sub(&op->pending, parts + 1U - i) == parts + 1U - i) {
+		complete(op);
+	}
+}
+
+static int submit(struct dma_memcpy_op *op, void *dst, size_t len,
+		  dma_memcpy_callback_t cb, void *user_data)
+{
+	k_spinlock_key_t key;
+	bool idle;
+
+	if (!op || !dst || !cb) {
+		return -EINVAL;
+	}
+
+	op->dst = dst;
+	op->len = len;
+	op->cb = cb;
+	op->user_data = user_data;
+
+	key = k_spin_lock(&lock);
+	idle = sys_slist_is_empty(&queue);
+
+	/* Small copies are queued behind pending ones to keep the order */
+	if (idle && (len < CONFIG_DMA_MEMCPY_THRESHOLD || num_chans == 0U)) {
+		k_spin_unlock(&lock, key);
+		op_cpu(op);
+		cb(op, 0, user_data);
+		return 0;
+	}
+
+	sys_slist_append(&queue, &op->node);
+	k_spin_unlock(&lock, key);
+
+	if (idle) {
+		start(op);
+	}
+
+	return 0;
+}
+
+int dma_memcpy_async(struct dma_memcpy_op *op, void *dst, const void *src,
+		     size_t len, dma_memcpy_callback_t cb, void *user_data)
+{
+	if (!op || !src) {
+		return -EINVAL;
+	}
+
+	op->src = src;
+
+	return submit(op, dst, len, cb, user_data);
+}
+
+int dma_memset_async(struct dma_memcpy_op *op, void *dst, uint8_t value,
+		     size_t len, dma_memcpy_callback_t cb, void *user_data)
+{
+	if (!op) {
+		return -EINVAL;
+	}
+
+	op->src = NULL;
+	op->value = value;
+
+	return submit(op, dst, len, cb, user_data);
+}
+
+static int dma_memcpy_init(const struct device *dev)
+{
+	ARG_UNUSED(dev);
+
+	if (!device_is_ready(dma_dev)) {
+		LOG_ERR("DMA controller not ready, copies done by the CPU");
+		return -ENODEV;
+	}
+
+	sys_slist_init(&queue);
+
+	for (num_chans = 0U; num_chans < CONFIG_DMA_MEMCPY_CHANNELS;
+	     num_chans++) {
+		int channel = dma_request_channel(dma_dev, NULL);
+
+		if (channel < 0) {
+			break;
+		}
+
+		chans[num_chans].id = channel;
+	}
+
+	LOG_DBG("%u channels", num_chans);
+
+	return 0;
+}
+
+SYS_INIT(dma_memcpy_init, POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY);
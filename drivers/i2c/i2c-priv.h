@@ -7,6 +7,7 @@
 #ifndef ZEPHYR_DRIVERS_I2C_I2C_PRIV_H_
 #define ZEPHYR_DRIVERS_I2C_I2C_PRIV_H_
 
+#include <kernel.h>
 #include <drivers/i2c.h>
 #include <dt-bindings/i2c/i2c.h>
 #include <logging/log.h>
@@ -35,6 +36,40 @@ static inline uint32_t i2c_map_dt_bitrate(uint32_t bitrate)
 	return 0;
 }
 
+#ifdef CONFIG_I2C_ASYNC
+/**
+ * Start an asynchronous transaction, the driver then reports its end with
+ * i2c_async_queue_complete(), usually from its interrupt handler.
+ */
+typedef int (*i2c_async_start_t)(const struct device *dev,
+				 struct i2c_txn *txn);
+
+/** Transaction queue of a controller, part of its driver data */
+struct i2c_async_queue {
+	const struct device *dev;
+	/* Interrupt or DMA driven start, NULL to run the transactions with
+	 * the transfer() API from the I2C work queue.
+	 */
+	i2c_async_start_t start;
+	struct k_spinlock lock;
+	/* Transactions waiting for the bus */
+	sys_slist_t pending;
+	/* Transaction on the bus */
+	struct i2c_txn *current;
+	struct k_work work;
+};
+
+void i2c_async_queue_init(struct i2c_async_queue *queue,
+			  const struct device *dev, i2c_async_start_t start);
+
+/* Implements the transfer_async() API */
+int i2c_async_queue_submit(struct i2c_async_queue *queue,
+			   struct i2c_txn *txn);
+
+/* Report the end of the transaction started by the start function */
+void i2c_async_queue_complete(struct i2c_async_queue *queue, int result);
+#endif /* CONFIG_I2C_ASYNC */
+
 #ifdef __cplusplus
 }
 #endif
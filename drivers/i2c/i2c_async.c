@@ -0,0 +1,154 @@
+/*
+ * Queue of asynchronous I2C transactions
+ *
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <init.h>
+#include <drivers/i2c.h>
+
+#define LOG_LEVEL CONFIG_I2C_LOG_LEVEL
+#include <logging/log.h>
+LOG_MODULE_REGISTER(i2c_async);
+
+#include "i2c-priv.h"
+
+static K_KERNEL_STACK_DEFINE(i2c_async_stack,
+			     CONFIG_I2C_ASYNC_WORKQ_STACK_SIZE);
+static struct k_work_q i2c_async_workq;
+
+/* Take the finished transaction off the bus, report its result and return
+ * the next one, which the caller has to start.
+ */
+static struct i2c_txn *finish(struct i2c_async_queue *queue, int result)
+{
+	struct i2c_txn *txn, *next = NULL;
+	k_spinlock_key_t key;
+	sys_snode_t *node;
+
+	key = k_spin_lock(&queue->lock);
+	txn = queue->current;
+	node = sys_slist_get(&queue->pending);
+	if (node) {
+		next = CONTAINER_OF(node, struct i2c_txn, node);
+	}
+	queue->current = next;
+	k_spin_unlock(&queue->lock, key);
+
+	if (result) {
+		LOG_DBG("%s: transaction to 0x%02x failed (%d)",
+			queue->dev->name, txn->addr, result);
+	}
+
+	if (txn->signal) {
+		k_poll_signal_raise(txn->signal, result);
+	}
+
+	if (txn->cb) {
+		txn->cb(queue->dev, result, txn->user_data);
+	}
+
+	return next;
+}
+
+static void queue_start(struct i2c_async_queue *queue, struct i2c_txn *txn)
+{
+	int err;
+
+	if (!txn) {
+		return;
+	}
+
+	if (!queue->start) {
+		k_work_submit_to_queue(&i2c_async_workq, &queue->work);
+		return;
+	}
+
+	while (txn) {
+		err = queue->start(queue->dev, txn);
+		if (!err) {
+			return;
+		}
+
+		txn = finish(queue, err);
+	}
+}
+
+/* Run the queued transactions back to back, without going through the
+ * work queue again for each of them.
+ */
+static void queue_work(struct k_work *work)
+{
+	struct i2c_async_queue *queue =
+		CONTAINER_OF(work, struct i2c_async_queue, work);
+	const struct i2c_driver_api *api = queue->dev->api;
+	struct i2c_txn *txn = queue->current;
+	int result;
+
+	while (txn) {
+		result = api->transfer(queue->dev, txn->msgs, txn->num_msgs,
+				       txn->addr);
+		txn = finish(queue, result);
+	}
+}
+
+void i2c_async_queue_init(struct i2c_async_queue *queue,
+			  const struct device *dev, i2c_async_start_t start)
+{
+	queue->dev = dev;
+	queue->start = start;
+	queue->current = NULL;
+	sys_slist_init(&queue->pending);
+	k_work_init(&queue->work, queue_work);
+}
+
+int i2c_async_queue_submit(struct i2c_async_queue *queue,
+			   struct i2c_txn *txn)
+{
+	k_spinlock_key_t key;
+	bool idle;
+
+	if (!txn->msgs && txn->num_msgs) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&queue->lock);
+	idle = (queue->current == NULL);
+	if (idle) {
+		queue->current = txn;
+	} else {
+		sys_slist_append(&queue->pending, &txn->node);
+	}
+	k_spin_unlock(&queue->lock, key);
+
+	if (idle) {
+		queue_start(queue, txn);
+	}
+
+	return 0;
+}
+
+void i2c_async_queue_complete(struct i2c_async_queue *queue, int result)
+{
+	queue_start(queue, finish(queue, result));
+}
+
+static int i2c_async_init(const struct device *dev)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "i2c_async",
+	};
+
+	ARG_UNUSED(dev);
+
+	k_work_queue_start(&i2c_async_workq, i2c_async_stack,
+			   K_KERNEL_STACK_SIZEOF(i2c_async_stack),
+			   CONFIG_I2C_ASYNC_WORKQ_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(i2c_async_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEVICE);
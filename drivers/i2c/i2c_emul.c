@@ -20,12 +20,18 @@ LOG_MODULE_REGISTER(i2c_emul_ctlr);
 #include <drivers/i2c.h>
 #include <drivers/i2c_emul.h>
 
+#include "i2c-priv.h"
+
 /** Working data for the device */
 struct i2c_emul_data {
 	/* List of struct i2c_emul associated with the device */
 	sys_slist_t emuls;
 	/* I2C host configuration */
 	uint32_t config;
+#ifdef CONFIG_I2C_ASYNC
+	/* Queued asynchronous transactions */
+	struct i2c_async_queue async;
+#endif
 };
 
 uint32_t i2c_emul_get_config(const struct device *dev)
@@ -93,6 +99,19 @@ static int i2c_emul_transfer(const struct device *dev, struct i2c_msg *msgs,
 	return 0;
 }
 
+#ifdef CONFIG_I2C_ASYNC
+static int i2c_emul_transfer_async(const struct device *dev,
+				   struct i2c_txn *txn)
+{
+	struct i2c_emul_data *data = dev->data;
+
+	/* Emulators have no interrupts, run the transactions from the I2C
+	 * work queue.
+	 */
+	return i2c_async_queue_submit(&data->async, txn);
+}
+#endif
+
 /**
  * Set up a new emulator and add it to the list
  *
@@ -105,6 +124,9 @@ static int i2c_emul_init(const struct device *dev)
 	int rc;
 
 	sys_slist_init(&data->emuls);
+#ifdef CONFIG_I2C_ASYNC
+	i2c_async_queue_init(&data->async, dev, NULL);
+#endif
 
 	rc = emul_init_for_bus_from_list(dev, list);
 
@@ -128,6 +150,9 @@ int i2c_emul_register(const struct device *dev, const char *name,
 static struct i2c_driver_api i2c_emul_api = {
 	.configure = i2c_emul_configure,
 	.transfer = i2c_emul_transfer,
+#ifdef CONFIG_I2C_ASYNC
+	.transfer_async = i2c_emul_transfer_async,
+#endif
 };
 
 #define EMUL_LINK_AND_COMMA(node_id) {		\
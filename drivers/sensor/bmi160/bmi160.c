@@ -858,6 +858,163 @@ static int bmi160_channel_get(const struct device *dev,
 	return 0;
 }
 
+#ifdef CONFIG_SENSOR_STREAM
+/* ODR 8 is 100 Hz, each step doubles or halves the rate */
+static uint32_t bmi160_odr_to_period_ns(uint8_t odr)
+{
+	if (odr < BMI160_ODR_25_32 || odr > BMI160_ODR_3200) {
+		return 0;
+	}
+
+	if (odr >= BMI160_ODR_100) {
+		return 10000000U >> (odr - BMI160_ODR_100);
+	}
+
+	return 10000000U << (BMI160_ODR_100 - odr);
+}
+
+static int bmi160_stream_set(const struct device *dev, bool enable)
+{
+	struct bmi160_data *data = to_data(dev);
+	uint8_t fifo_cfg = 0U;
+	uint32_t period_ns = 0U;
+	uint8_t odr;
+
+	if (enable) {
+		if (bmi160_byte_read(dev, BMI160_FIFO_ODR_REG, &odr) < 0) {
+			return -EIO;
+		}
+
+		odr &= BMI160_ACC_CONF_ODR_MASK;
+
+#if !defined(CONFIG_BMI160_GYRO_PMU_SUSPEND) && \
+	!defined(CONFIG_BMI160_ACCEL_PMU_SUSPEND)
+		uint8_t gyr_odr;
+
+		if (bmi160_byte_read(dev, BMI160_REG_GYR_CONF, &gyr_odr) < 0) {
+			return -EIO;
+		}
+
+		/* Headerless frames need both sensors at the same rate */
+		if ((gyr_odr & BMI160_GYR_CONF_ODR_MASK) != odr) {
+			LOG_DBG("Accel and gyro ODR differ.");
+			return -EINVAL;
+		}
+#endif
+
+		period_ns = bmi160_odr_to_period_ns(odr);
+		if (!period_ns) {
+			return -EINVAL;
+		}
+
+		fifo_cfg = BMI160_FIFO_FRAME_EN;
+	}
+
+	if (bmi160_byte_write(dev, BMI160_REG_FIFO_CONFIG1, fifo_cfg) < 0 ||
+	    bmi160_byte_write(dev, BMI160_REG_CMD,
+			      BMI160_CMD_FIFO_FLUSH) < 0) {
+		return -EIO;
+	}
+
+	data->fifo_period_ns = period_ns;
+
+	return 0;
+}
+
+static int bmi160_stream_read(const struct device *dev,
+			      struct sensor_frame *frame, size_t size)
+{
+	struct bmi160_data *data = to_data(dev);
+	uint16_t fifo_len, avail, count;
+	uint32_t len, pos, chunk;
+	uint64_t now;
+
+	if (!data->fifo_period_ns) {
+		return -EINVAL;
+	}
+
+	if (bmi160_word_read(dev, BMI160_REG_FIFO_LENGTH0, &fifo_len) < 0) {
+		return -EIO;
+	}
+
+	now = k_ticks_to_ns_floor64(k_uptime_ticks());
+	avail = (fifo_len & BMI160_FIFO_LENGTH_MASK) / BMI160_SAMPLE_SIZE;
+	count = MIN(avail, (size - sizeof(*frame)) / BMI160_SAMPLE_SIZE);
+
+	/* The newest buffered frame was taken less than a period ago */
+	frame->period_ns = data->fifo_period_ns;
+	frame->timestamp_ns = now - (uint64_t)(avail ? avail - 1U : 0U) *
+				    data->fifo_period_ns;
+	frame->sample_size = BMI160_SAMPLE_SIZE;
+	frame->num_samples = 0U;
+
+	/* Drain in bursts of whole frames, as few as the bus allows */
+	len = count * BMI160_SAMPLE_SIZE;
+	for (pos = 0U; pos < len; pos += chunk) {
+		chunk = MIN(len - pos, BMI160_FIFO_READ_MAX);
+
+		if (bmi160_read(dev, BMI160_REG_FIFO_DATA, &frame->data[pos],
+				chunk) < 0) {
+			return -EIO;
+		}
+	}
+
+	frame->num_samples = count;
+
+	return count;
+}
+
+static int bmi160_frame_decode(const struct device *dev,
+			       const struct sensor_frame *frame,
+			       uint16_t index, enum sensor_channel chan,
+			       struct sensor_value *val)
+{
+	struct bmi160_data *data = to_data(dev);
+	uint16_t raw_xyz[BMI160_AXES];
+	const uint8_t *raw;
+	uint16_t scale;
+	int i;
+
+	if (frame->sample_size != BMI160_SAMPLE_SIZE) {
+		return -EINVAL;
+	}
+
+	raw = &frame->data[index * BMI160_SAMPLE_SIZE];
+
+	switch (chan) {
+#if !defined(CONFIG_BMI160_GYRO_PMU_SUSPEND)
+	case SENSOR_CHAN_GYRO_X:
+	case SENSOR_CHAN_GYRO_Y:
+	case SENSOR_CHAN_GYRO_Z:
+	case SENSOR_CHAN_GYRO_XYZ:
+		raw += offsetof(union bmi160_sample, gyr);
+		scale = data->scale.gyr;
+		break;
+#endif
+#if !defined(CONFIG_BMI160_ACCEL_PMU_SUSPEND)
+	case SENSOR_CHAN_ACCEL_X:
+	case SENSOR_CHAN_ACCEL_Y:
+	case SENSOR_CHAN_ACCEL_Z:
+	case SENSOR_CHAN_ACCEL_XYZ:
+		raw += offsetof(union bmi160_sample, acc);
+		scale = data->scale.acc;
+		break;
+#endif
+	default:
+		LOG_DBG("Channel not supported.");
+		return -ENOTSUP;
+	}
+
+	for (i = 0; i < BMI160_AXES; i++) {
+		raw_xyz[i] = sys_get_le16(&raw[i * sizeof(uint16_t)]);
+	}
+
+	bmi160_channel_convert(chan, scale, raw_xyz, val);
+
+	return 0;
+}
+#endif /* CONFIG_SENSOR_STREAM */
+
 static const struct sensor_driver_api bmi160_api = {
 	.attr_set = bmi160_attr_set,
 #ifdef CONFIG_BMI160_TRIGGER
@@ -865,6 +1022,11 @@ static const struct sensor_driver_api bmi160_api = {
 #endif
 	.sample_fetch = bmi160_sample_fetch,
 	.channel_get = bmi160_channel_get,
+#ifdef CONFIG_SENSOR_STREAM
+	.stream_set = bmi160_stream_set,
+	.stream_read = bmi160_stream_read,
+	.frame_decode = bmi160_frame_decode,
+#endif
 };
 
 int bmi160_init(const struct device *dev)
@@ -189,6 +189,17 @@
 #define BMI160_GYR_CONF_BWP_POS	4
 #define BMI160_GYR_CONF_BWP_MASK	(0x3 << 4)
 
+/* BMI160_REG_FIFO_LENGTH0/1 */
+#define BMI160_FIFO_LENGTH_MASK		0x7FF
+
+/* BMI160_REG_FIFO_CONFIG1 */
+#define BMI160_FIFO_HEADER_EN		BIT(4)
+#define BMI160_FIFO_MAG_EN		BIT(5)
+#define BMI160_FIFO_ACC_EN		BIT(6)
+#define BMI160_FIFO_GYR_EN		BIT(7)
+
+#define BMI160_FIFO_SIZE		1024
+
 /* BMI160_REG_OFFSET_EN */
 #define BMI160_GYR_OFS_EN_POS		7
 #define BMI160_ACC_OFS_EN_POS		6
@@ -204,6 +215,7 @@
 #define BMI160_CMD_PMU_ACC		0x10
 #define BMI160_CMD_PMU_GYR		0x14
 #define BMI160_CMD_PMU_MAG		0x18
+#define BMI160_CMD_FIFO_FLUSH		0xB0
 #define BMI160_CMD_SOFT_RESET		0xB6
 
 #define BMI160_CMD_PMU_BIT		0x10
@@ -465,6 +477,25 @@ union bmi160_pmu_status {
 
 #define BMI160_BUF_SIZE			(BMI160_SAMPLE_SIZE)
 
+/*
+ * Headerless FIFO frames hold the same data as a sample, the ODR of the
+ * enabled sensors must then be the same.
+ */
+#if defined(CONFIG_BMI160_GYRO_PMU_SUSPEND)
+#	define BMI160_FIFO_FRAME_EN	BMI160_FIFO_ACC_EN
+#	define BMI160_FIFO_ODR_REG	BMI160_REG_ACC_CONF
+#elif defined(CONFIG_BMI160_ACCEL_PMU_SUSPEND)
+#	define BMI160_FIFO_FRAME_EN	BMI160_FIFO_GYR_EN
+#	define BMI160_FIFO_ODR_REG	BMI160_REG_GYR_CONF
+#else
+#	define BMI160_FIFO_FRAME_EN	(BMI160_FIFO_GYR_EN | BMI160_FIFO_ACC_EN)
+#	define BMI160_FIFO_ODR_REG	BMI160_REG_ACC_CONF
+#endif
+
+/* Longest FIFO burst read, a whole number of frames */
+#define BMI160_FIFO_READ_MAX		((UINT8_MAX / BMI160_SAMPLE_SIZE) * \
+					 BMI160_SAMPLE_SIZE)
+
 /* Each sample has X, Y and Z */
 union bmi160_sample {
 	uint8_t raw[BMI160_BUF_SIZE];
@@ -494,6 +525,11 @@ struct bmi160_data {
 	union bmi160_sample sample;
 	struct bmi160_scale scale;
 
+#ifdef CONFIG_SENSOR_STREAM
+	/* Time between two FIFO frames, 0 when not streaming */
+	uint32_t fifo_period_ns;
+#endif
+
 #ifdef CONFIG_BMI160_TRIGGER_OWN_THREAD
 	struct k_sem sem;
 #endif
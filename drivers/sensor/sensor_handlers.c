@@ -57,3 +57,72 @@ static inline int z_vrfy_sensor_channel_get(const struct device *dev,
 					 (struct sensor_value *)val);
 }
 #include <syscalls/sensor_channel_get_mrsh.c>
+
+#ifdef CONFIG_SENSOR_STREAM
+static inline int z_vrfy_sensor_stream_start(const struct device *dev)
+{
+	Z_OOPS(Z_SYSCALL_DRIVER_SENSOR(dev, stream_set));
+	return z_impl_sensor_stream_start((const struct device *)dev);
+}
+#include <syscalls/sensor_stream_start_mrsh.c>
+
+static inline int z_vrfy_sensor_stream_stop(const struct device *dev)
+{
+	Z_OOPS(Z_SYSCALL_DRIVER_SENSOR(dev, stream_set));
+	return z_impl_sensor_stream_stop((const struct device *)dev);
+}
+#include <syscalls/sensor_stream_stop_mrsh.c>
+
+static inline int z_vrfy_sensor_stream_read(const struct device *dev,
+					    struct sensor_frame *frame,
+					    size_t size)
+{
+	Z_OOPS(Z_SYSCALL_DRIVER_SENSOR(dev, stream_read));
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(frame, size));
+	return z_impl_sensor_stream_read((const struct device *)dev,
+					 (struct sensor_frame *)frame, size);
+}
+#include <syscalls/sensor_stream_read_mrsh.c>
+
+/* Largest sample copied in from a user frame for decoding, in bytes */
+#define SENSOR_FRAME_SAMPLE_MAX 32
+
+/*
+ * The frame lives in user memory and may change under the driver, so the
+ * header and the requested sample are copied in and the driver decodes the
+ * copy, a frame of a single sample.
+ */
+static inline int z_vrfy_sensor_frame_decode(const struct device *dev,
+					     const struct sensor_frame *frame,
+					     uint16_t index,
+					     enum sensor_channel chan,
+					     struct sensor_value *val)
+{
+	uint8_t buf[sizeof(struct sensor_frame) + SENSOR_FRAME_SAMPLE_MAX]
+		__aligned(__alignof__(struct sensor_frame));
+	struct sensor_frame *copy = (struct sensor_frame *)buf;
+	size_t offset;
+
+	Z_OOPS(Z_SYSCALL_DRIVER_SENSOR(dev, frame_decode));
+	Z_OOPS(z_user_from_copy(copy, frame, sizeof(*copy)));
+
+	if ((index >= copy->num_samples) ||
+	    (copy->sample_size > SENSOR_FRAME_SAMPLE_MAX)) {
+		return -EINVAL;
+	}
+
+	offset = (size_t)index * copy->sample_size;
+	Z_OOPS(z_user_from_copy(copy->data, &frame->data[offset],
+				copy->sample_size));
+	copy->num_samples = 1U;
+
+	Z_OOPS(Z_SYSCALL_MEMORY_WRITE(val, sizeof(struct sensor_value) *
+				      ((chan == SENSOR_CHAN_ACCEL_XYZ ||
+					chan == SENSOR_CHAN_GYRO_XYZ ||
+					chan == SENSOR_CHAN_MAGN_XYZ) ? 3 : 1)));
+	return z_impl_sensor_frame_decode((const struct device *)dev, copy,
+					  0U, chan,
+					  (struct sensor_value *)val);
+}
+#include <syscalls/sensor_frame_decode_mrsh.c>
+#endif /* CONFIG_SENSOR_STREAM */
@@ -423,6 +423,51 @@ int bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info);
 int bt_conn_get_remote_info(struct bt_conn *conn,
 			    struct bt_conn_remote_info *remote_info);
 
+/** @brief Connection Transmit Statistics Structure
+ *
+ *  @note Only available if @option{CONFIG_BT_CONN_TX_STATS} is enabled.
+ */
+struct bt_conn_tx_stats {
+	/** Packets queued for transmission */
+	uint32_t queued;
+
+	/** Highest number of queued packets */
+	uint32_t max_queued;
+
+	/** Packets completely handed over to the controller */
+	uint32_t sent;
+
+	/** HCI data packets (fragments) sent to the controller */
+	uint32_t fragments;
+
+	/** Fragments not yet completed by the controller */
+	uint32_t in_flight;
+
+	/** Highest number of fragments in flight */
+	uint32_t max_in_flight;
+
+	/** Times a packet was ready but no controller buffer was free */
+	uint32_t credit_stalls;
+
+	/** Controller buffers shared by the connections of this type */
+	uint16_t credits;
+
+	/** Controller buffers currently free */
+	uint16_t credits_free;
+};
+
+/** @brief Get connection transmit statistics.
+ *
+ *  The statistics are accumulated since the connection was established.
+ *
+ *  @param conn  Connection object.
+ *  @param stats Connection transmit statistics object.
+ *
+ *  @return Zero on success or (negative) error code on failure.
+ *  @return -ENOTSUP @option{CONFIG_BT_CONN_TX_STATS} is not enabled.
+ */
+int bt_conn_tx_stats_get(struct bt_conn *conn, struct bt_conn_tx_stats *stats);
+
 /** @brief Get connection transmit power level.
  *
  *  @param conn           Connection object.
@@ -954,6 +954,24 @@ int bt_gatt_notify_cb(struct bt_conn *conn,
 int bt_gatt_notify_multiple(struct bt_conn *conn, uint16_t num_params,
 			    struct bt_gatt_notify_params *params);
 
+/** @brief Notify attribute value changes to all subscribed peers.
+ *
+ *  This function works in the same way as calling @ref bt_gatt_notify_cb
+ *  with a NULL connection for each of the parameters, except that the
+ *  attributes and their CCC descriptors are only looked up once and the
+ *  notifications are then sent one connection at a time. Peers that
+ *  support the Notify Multiple Characteristic Values procedure get all
+ *  their notifications coalesced into as few PDUs as their MTU allows.
+ *
+ *  @param num_params Number of notification parameters.
+ *  @param params Array of notification parameters.
+ *
+ *  @return 0 if at least one peer was notified or negative value in case
+ *  of error, -ENOTCONN if no peer has notifications enabled.
+ */
+int bt_gatt_notify_fanout(uint16_t num_params,
+			  struct bt_gatt_notify_params *params);
+
 /** @brief Notify attribute value change.
  *
  *  Send notification of attribute value change, if connection is NULL notify
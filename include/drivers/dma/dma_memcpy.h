@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Memory copy offload to a DMA controller
+ */
+
+#ifndef ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_MEMCPY_H_
+#define ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_MEMCPY_H_
+
+#include <zephyr/types.h>
+#include <sys/atomic.h>
+#include <sys/slist.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief DMA memory copy offload
+ * @defgroup dma_memcpy DMA memory copy offload
+ * @ingroup dma_interface
+ * @{
+ */
+
+struct dma_memcpy_op;
+
+/**
+ * @typedef dma_memcpy_callback_t
+ * @brief Completion callback of a memory copy.
+ *
+ * Called from the completion interrupt of the DMA controller, or from the
+ * caller when the copy was done by the CPU.
+ *
+ * @param op Completed operation, it can be reused from the callback.
+ * @param status 0 on success, a negative errno code otherwise.
+ * @param user_data User data given when submitting the operation.
+ */
+typedef void (*dma_memcpy_callback_t)(struct dma_memcpy_op *op, int status,
+				      void *user_data);
+
+/**
+ * @brief Memory copy operation.
+ *
+ * Owned by the caller, it must stay valid until its callback is called.
+ * The members are private to the service.
+ */
+struct dma_memcpy_op {
+	sys_snode_t node;
+	void *dst;
+	const void *src;
+	size_t len;
+	dma_memcpy_callback_t cb;
+	void *user_data;
+	/* Channels still transferring a part of the operation */
+	atomic_t pending;
+	int status;
+	/* Source of the transfer when filling memory */
+	uint8_t value;
+};
+
+/**
+ * @brief Copy memory asynchronously.
+ *
+ * Copies of at least CONFIG_DMA_MEMCPY_THRESHOLD bytes are split
+ * across the channels of the DMA controller chosen as
+ * ``zephyr,dma-memcpy`` in the devicetree. Smaller ones are done by the
+ * CPU before returning, unless operations are pending, in which case they
+ * are queued and done by a single channel. Operations are done one after
+ * the other, in the order they were submitted. The buffers must not
+ * overlap.
+ *
+ * @param op Operation, unused until the callback is called.
+ * @param dst Destination buffer.
+ * @param src Source buffer.
+ * @param len Number of bytes to copy.
+ * @param cb Completion callback.
+ * @param user_data User data given to the callback.
+ *
+ * @retval 0 If the copy is done or was started.
+ * @retval -EINVAL If an argument is invalid.
+ */
+int dma_memcpy_async(struct dma_memcpy_op *op, void *dst, const void *src,
+		     size_t len, dma_memcpy_callback_t cb, void *user_data);
+
+/**
+ * @brief Fill memory asynchronously.
+ *
+ * Same as dma_memcpy_async() with every byte of @a dst set to @a value.
+ *
+ * @param op Operation, unused until the callback is called.
+ * @param dst Destination buffer.
+ * @param value Value of the bytes.
+ * @param len Number of bytes to set.
+ * @param cb Completion callback.
+ * @param user_data User data given to the callback.
+ *
+ * @retval 0 If the fill is done or was started.
+ * @retval -EINVAL If an argument is invalid.
+ */
+int dma_memset_async(struct dma_memcpy_op *op, void *dst, uint8_t value,
+		     size_t len, dma_memcpy_callback_t cb, void *user_data);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_DRIVERS_DMA_DMA_MEMCPY_H_ */
@@ -21,6 +21,7 @@
 
 #include <zephyr/types.h>
 #include <device.h>
+#include <sys/slist.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -114,6 +115,55 @@ struct i2c_msg {
 	uint8_t		flags;
 };
 
+#if defined(CONFIG_I2C_ASYNC) || defined(__DOXYGEN__)
+
+struct k_poll_signal;
+
+/**
+ * @brief Function called when an asynchronous transaction is complete.
+ *
+ * It may be called from interrupt context and may queue the next
+ * transaction.
+ *
+ * @param dev Pointer to the device structure of the I2C controller.
+ * @param result 0 if the transaction succeeded, negative errno code
+ * otherwise.
+ * @param user_data User data of the transaction.
+ */
+typedef void (*i2c_callback_t)(const struct device *dev, int result,
+			       void *user_data);
+
+/**
+ * @brief One asynchronous I2C transaction.
+ *
+ * The transaction, its messages and their buffers must stay valid until
+ * the transaction is complete.
+ */
+struct i2c_txn {
+	/** Private, do not modify */
+	sys_snode_t node;
+
+	/** Messages of the transaction */
+	struct i2c_msg *msgs;
+
+	/** Number of messages */
+	uint8_t num_msgs;
+
+	/** Address of the I2C target device */
+	uint16_t addr;
+
+	/** Completion callback, or NULL */
+	i2c_callback_t cb;
+
+	/** User data passed to @c cb */
+	void *user_data;
+
+	/** Signal raised with the result on completion, or NULL */
+	struct k_poll_signal *signal;
+};
+
+#endif /* CONFIG_I2C_ASYNC */
+
 /**
  * @cond INTERNAL_HIDDEN
  *
@@ -133,6 +183,10 @@ typedef int (*i2c_api_slave_register_t)(const struct device *dev,
 typedef int (*i2c_api_slave_unregister_t)(const struct device *dev,
 					  struct i2c_slave_config *cfg);
 typedef int (*i2c_api_recover_bus_t)(const struct device *dev);
+#ifdef CONFIG_I2C_ASYNC
+typedef int (*i2c_api_transfer_async_t)(const struct device *dev,
+					struct i2c_txn *txn);
+#endif /* CONFIG_I2C_ASYNC */
 
 __subsystem struct i2c_driver_api {
 	i2c_api_configure_t configure;
@@ -140,6 +194,9 @@ __subsystem struct i2c_driver_api {
 	i2c_api_slave_register_t slave_register;
 	i2c_api_slave_unregister_t slave_unregister;
 	i2c_api_recover_bus_t recover_bus;
+#ifdef CONFIG_I2C_ASYNC
+	i2c_api_transfer_async_t transfer_async;
+#endif /* CONFIG_I2C_ASYNC */
 };
 
 typedef int (*i2c_slave_api_register_t)(const struct device *dev);
@@ -357,6 +414,46 @@ static inline int z_impl_i2c_transfer(const struct device *dev,
 	return api->transfer(dev, msgs, num_msgs, addr);
 }
 
+/* Doxygen defines this so documentation is generated. */
+#ifdef CONFIG_I2C_ASYNC
+
+/**
+ * @brief Queue a data transfer to another I2C device in master mode.
+ *
+ * The transaction is appended to the transaction queue of the controller
+ * and this routine returns without waiting for it. Transactions are
+ * performed one after the other in the order they were queued, so a
+ * driver may queue a batch of transactions, e.g. reading several devices
+ * on the same bus, and only wait for the last one. Completion is
+ * reported through the callback and the poll signal of the transaction,
+ * both optional.
+ *
+ * @note This function is available only if @option{CONFIG_I2C_ASYNC}
+ * is selected.
+ *
+ * @param dev Pointer to the device structure for an I2C controller
+ * driver configured in master mode.
+ * @param txn Transaction to queue.
+ *
+ * @retval 0 If the transaction was queued.
+ * @retval -EINVAL If the transaction is invalid.
+ * @retval -ENOSYS If asynchronous transfers are not implemented.
+ */
+static inline int i2c_transfer_async(const struct device *dev,
+				     struct i2c_txn *txn)
+{
+	const struct i2c_driver_api *api =
+		(const struct i2c_driver_api *)dev->api;
+
+	if (api->transfer_async == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->transfer_async(dev, txn);
+}
+
+#endif /* CONFIG_I2C_ASYNC */
+
 /**
  * @brief Recover the I2C bus
  *
@@ -371,12 +371,70 @@ typedef int (*sensor_channel_get_t)(const struct device *dev,
 				    enum sensor_channel chan,
 				    struct sensor_value *val);
 
+#if defined(CONFIG_SENSOR_STREAM) || defined(__DOXYGEN__)
+/**
+ * @brief Frame of raw samples read from the FIFO of a sensor
+ *
+ * The samples are kept in the format of the sensor and only converted by
+ * sensor_frame_decode(), for the channels and samples the consumer needs.
+ */
+struct sensor_frame {
+	/** Uptime at which the first sample was taken, in nanoseconds */
+	uint64_t timestamp_ns;
+
+	/** Time between two samples, in nanoseconds */
+	uint32_t period_ns;
+
+	/** Number of samples in the frame */
+	uint16_t num_samples;
+
+	/** Size of a sample, in bytes */
+	uint16_t sample_size;
+
+	/** Raw samples */
+	uint8_t data[];
+};
+
+/**
+ * @typedef sensor_stream_set_t
+ * @brief Callback API for starting or stopping streaming
+ *
+ * See sensor_stream_start() for argument description
+ */
+typedef int (*sensor_stream_set_t)(const struct device *dev, bool enable);
+
+/**
+ * @typedef sensor_stream_read_t
+ * @brief Callback API for reading the FIFO of a sensor
+ *
+ * See sensor_stream_read() for argument description
+ */
+typedef int (*sensor_stream_read_t)(const struct device *dev,
+				    struct sensor_frame *frame, size_t size);
+
+/**
+ * @typedef sensor_frame_decode_t
+ * @brief Callback API for decoding a sample of a frame
+ *
+ * See sensor_frame_decode() for argument description
+ */
+typedef int (*sensor_frame_decode_t)(const struct device *dev,
+				     const struct sensor_frame *frame,
+				     uint16_t index, enum sensor_channel chan,
+				     struct sensor_value *val);
+#endif /* CONFIG_SENSOR_STREAM */
+
 __subsystem struct sensor_driver_api {
 	sensor_attr_set_t attr_set;
 	sensor_attr_get_t attr_get;
 	sensor_trigger_set_t trigger_set;
 	sensor_sample_fetch_t sample_fetch;
 	sensor_channel_get_t channel_get;
+#if defined(CONFIG_SENSOR_STREAM)
+	sensor_stream_set_t stream_set;
+	sensor_stream_read_t stream_read;
+	sensor_frame_decode_t frame_decode;
+#endif /* CONFIG_SENSOR_STREAM */
 };
 
 /**
@@ -566,6 +624,130 @@ static inline int z_impl_sensor_channel_get(const struct device *dev,
 	return api->channel_get(dev, chan, val);
 }
 
+#if defined(CONFIG_SENSOR_STREAM) || defined(__DOXYGEN__)
+/**
+ * @brief Start streaming samples through the FIFO of a sensor
+ *
+ * The sensor buffers its samples in its FIFO, which the application then
+ * drains with @ref sensor_stream_read at its own pace, instead of
+ * fetching the samples one by one.
+ *
+ * @param dev Pointer to the sensor device
+ *
+ * @return 0 if successful, -ENOSYS if the sensor does not support
+ * streaming, other negative errno code if failure.
+ */
+__syscall int sensor_stream_start(const struct device *dev);
+
+static inline int z_impl_sensor_stream_start(const struct device *dev)
+{
+	const struct sensor_driver_api *api =
+		(const struct sensor_driver_api *)dev->api;
+
+	if (api->stream_set == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->stream_set(dev, true);
+}
+
+/**
+ * @brief Stop streaming samples
+ *
+ * @param dev Pointer to the sensor device
+ *
+ * @return 0 if successful, negative errno code if failure.
+ */
+__syscall int sensor_stream_stop(const struct device *dev);
+
+static inline int z_impl_sensor_stream_stop(const struct device *dev)
+{
+	const struct sensor_driver_api *api =
+		(const struct sensor_driver_api *)dev->api;
+
+	if (api->stream_set == NULL) {
+		return -ENOSYS;
+	}
+
+	return api->stream_set(dev, false);
+}
+
+/**
+ * @brief Read the samples buffered by a streaming sensor
+ *
+ * Drain the FIFO of the sensor into a frame, in as few bus transfers as
+ * possible. The samples are not converted, use @ref sensor_frame_decode
+ * to get their values. If more samples are buffered than fit in @a size,
+ * the oldest ones are read and the others are left for the next call.
+ *
+ * @param dev Pointer to the sensor device
+ * @param frame Frame to fill, at least sizeof(struct sensor_frame) bytes
+ * @param size Size of the frame buffer, in bytes
+ *
+ * @return Number of samples read if successful, negative errno code if
+ * failure.
+ */
+__syscall int sensor_stream_read(const struct device *dev,
+				 struct sensor_frame *frame, size_t size);
+
+static inline int z_impl_sensor_stream_read(const struct device *dev,
+					    struct sensor_frame *frame,
+					    size_t size)
+{
+	const struct sensor_driver_api *api =
+		(const struct sensor_driver_api *)dev->api;
+
+	if (api->stream_read == NULL) {
+		return -ENOSYS;
+	}
+
+	if (size < sizeof(*frame)) {
+		return -EINVAL;
+	}
+
+	return api->stream_read(dev, frame, size);
+}
+
+/**
+ * @brief Decode a channel of a sample read by @ref sensor_stream_read
+ *
+ * Vectorial channels with an _XYZ suffix are returned at val[0], val[1]
+ * and val[2], as with @ref sensor_channel_get.
+ *
+ * @param dev Pointer to the sensor device the frame was read from
+ * @param frame Frame holding the sample
+ * @param index Index of the sample in the frame
+ * @param chan The channel to decode
+ * @param val Where to store the value
+ *
+ * @return 0 if successful, negative errno code if failure.
+ */
+__syscall int sensor_frame_decode(const struct device *dev,
+				  const struct sensor_frame *frame,
+				  uint16_t index, enum sensor_channel chan,
+				  struct sensor_value *val);
+
+static inline int z_impl_sensor_frame_decode(const struct device *dev,
+					     const struct sensor_frame *frame,
+					     uint16_t index,
+					     enum sensor_channel chan,
+					     struct sensor_value *val)
+{
+	const struct sensor_driver_api *api =
+		(const struct sensor_driver_api *)dev->api;
+
+	if (api->frame_decode == NULL) {
+		return -ENOSYS;
+	}
+
+	if (index >= frame->num_samples) {
+		return -EINVAL;
+	}
+
+	return api->frame_decode(dev, frame, index, chan, val);
+}
+#endif /* CONFIG_SENSOR_STREAM */
+
 /**
  * @brief The value of gravitational constant in micro m/s^2.
  */
@@ -495,6 +495,17 @@ __syscall void k_wakeup(k_tid_t thread);
  */
 __syscall k_tid_t k_current_get(void) __attribute_const__;
 
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+#ifdef CONFIG_CURRENT_THREAD_USE_TLS
+/* ID of the current thread, readable from user mode without a syscall */
+extern __thread k_tid_t z_tls_current;
+#endif
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
 /**
  * @brief Abort a thread.
  *
@@ -733,6 +744,63 @@ __syscall void k_thread_priority_set(k_tid_t thread, int prio);
 __syscall void k_thread_deadline_set(k_tid_t thread, int deadline);
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_RESERVATION
+/**
+ * @brief Reserve a runtime every period for a thread
+ *
+ * The thread runs as a sequence of jobs, each one ended by
+ * k_thread_reservation_wait_next(). A job is released at the start of a
+ * period and has the end of that period as its deadline, which the
+ * scheduler uses as with k_thread_deadline_set(). If a job runs for longer
+ * than @a runtime_us, its deadline is postponed by a period with a new
+ * budget, so that it cannot delay the jobs of other reserved threads.
+ *
+ * The reservation is only granted if the sum of the runtime / period
+ * ratios of all reservations stays within
+ * @option{CONFIG_SCHED_DEADLINE_MAX_UTILIZATION} percent, each ratio being
+ * rounded up to a part per million. It is released when the thread exits,
+ * or by setting a runtime of 0.
+ *
+ * The first job starts with the call.
+ *
+ * @note You should enable @option{CONFIG_SCHED_DEADLINE_RESERVATION} in
+ * your project configuration.
+ *
+ * @param thread Thread to reserve for
+ * @param runtime_us Runtime of each job in microseconds, 0 to release
+ * @param period_us Period in microseconds
+ *
+ * @retval 0 Reservation set
+ * @retval -EINVAL Runtime longer than the period, or period too long
+ * @retval -EBUSY Not enough utilization left
+ */
+__syscall int k_thread_reservation_set(k_tid_t thread, uint32_t runtime_us,
+				       uint32_t period_us);
+
+/**
+ * @brief End the current job and wait for the next period
+ *
+ * Must be called by a thread with a reservation.
+ *
+ * @retval 0 The job completed before its deadline
+ * @retval -ETIME The job missed its deadline
+ * @retval -EINVAL The thread has no reservation
+ */
+__syscall int k_thread_reservation_wait_next(void);
+
+/**
+ * @brief Get the statistics of a thread's reservations
+ *
+ * The statistics are kept when a reservation is released, and counted
+ * since the thread was created.
+ *
+ * @param thread Thread to get the statistics of
+ * @param stats Filled with the statistics
+ */
+__syscall void k_thread_reservation_stats_get(k_tid_t thread,
+					      struct k_thread_reservation_stats *stats);
+#endif
+
 #ifdef CONFIG_SCHED_CPU_MASK
 /**
  * @brief Sets all CPU enable masks to zero
@@ -2536,6 +2604,31 @@ struct k_mutex {
  * INTERNAL_HIDDEN @endcond
  */
 
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+/*
+ * Kernel side state of a sys_mutex. The backing k_mutex arbitrates
+ * ownership once the mutex is contended, and num_waiters counts threads
+ * inside the contended lock path so that the user space fast path is only
+ * re-enabled once none are left.
+ */
+struct z_sys_mutex_data {
+	struct k_mutex mutex;
+	struct k_spinlock lock;
+	uint32_t num_waiters;
+};
+
+#define Z_SYS_MUTEX_DATA_INITIALIZER(obj) \
+	{ \
+	.mutex = Z_MUTEX_INITIALIZER(obj.mutex), \
+	}
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
 /**
  * @brief Statically define and initialize a mutex.
  *
@@ -2609,6 +2702,35 @@ __syscall int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout);
  */
 __syscall int k_mutex_unlock(struct k_mutex *mutex);
 
+#if defined(CONFIG_ADAPTIVE_SPIN) || defined(__DOXYGEN__)
+/**
+ * @brief Adaptive spinning statistics
+ *
+ * A hit is a spin which ended with the mutex or semaphore taken, a miss
+ * one after which the thread had to pend anyway.
+ */
+struct k_adaptive_spin_stats {
+	/** Mutex spins which took the mutex */
+	uint32_t mutex_hits;
+	/** Mutex spins followed by pending */
+	uint32_t mutex_misses;
+	/** Semaphore spins which took the semaphore */
+	uint32_t sem_hits;
+	/** Semaphore spins followed by pending */
+	uint32_t sem_misses;
+};
+
+/**
+ * @brief Get the adaptive spinning statistics
+ *
+ * Counts the spins done by k_mutex_lock() and k_sem_take() since boot, for
+ * all mutexes and semaphores.
+ *
+ * @param stats Filled with the statistics
+ */
+void k_adaptive_spin_stats_get(struct k_adaptive_spin_stats *stats);
+#endif
+
 /**
  * @}
  */
@@ -3053,6 +3175,48 @@ void k_work_queue_start(struct k_work_q *queue,
  */
 static inline k_tid_t k_work_queue_thread_get(struct k_work_q *queue);
 
+/** @brief Initialize a work queue served by a pool of threads.
+ *
+ * This behaves like k_work_queue_start() but services the queue with @p
+ * num_threads threads, so a slow handler does not hold up unrelated items
+ * and, on SMP, items can be processed on several CPUs at once.
+ *
+ * All existing work item guarantees are kept: a work item is never run
+ * concurrently with itself, flushes complete when the flushed instance of
+ * the handler returns, and a drain completes only when every pool thread
+ * is idle.  Items that are independent of each other may however complete
+ * out of submission order.
+ *
+ * The first pool thread is the queue's own thread, returned by
+ * k_work_queue_thread_get().
+ *
+ * @note Requires @option{CONFIG_WORKQUEUE_POOL}.
+ *
+ * @param queue pointer to the queue structure.
+ *
+ * @param stacks first element of an array of @p num_threads stacks declared
+ * with K_THREAD_STACK_ARRAY_DEFINE() using @p stack_size.
+ *
+ * @param stack_size size of each work thread stack area, in bytes, as
+ * passed to K_THREAD_STACK_ARRAY_DEFINE().
+ *
+ * @param threads array of @p num_threads - 1 thread objects for the
+ * additional pool threads.  May be NULL if @p num_threads is 1.
+ *
+ * @param num_threads number of threads serving the queue, at least 1 and
+ * at most 255.
+ *
+ * @param prio initial priority of all pool threads
+ *
+ * @param cfg optional additional configuration parameters.  Pass @c
+ * NULL if not required, to use the defaults documented in
+ * k_work_queue_config.
+ */
+void k_work_queue_pool_start(struct k_work_q *queue,
+			     k_thread_stack_t *stacks, size_t stack_size,
+			     struct k_thread *threads, size_t num_threads,
+			     int prio, const struct k_work_queue_config *cfg);
+
 /** @brief Wait until the work queue has drained, optionally plugging it.
  *
  * This blocks submission to the work queue except when coming from queue
@@ -3518,6 +3682,12 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Item being flushed, so that pool threads do not signal the
+	 * flush while another pool thread is still running it.
+	 */
+	struct k_work *target;
+#endif
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -3582,6 +3752,17 @@ struct k_work_queue_config {
 	 * control.
 	 */
 	bool no_yield;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/** Control whether the threads of a pool work queue are pinned
+	 * to CPUs.
+	 *
+	 * When @c true pool thread @em i may only run on CPU @em i modulo
+	 * the number of CPUs.  This requires @option{CONFIG_SCHED_CPU_MASK}
+	 * and is ignored otherwise.
+	 */
+	bool pin_threads;
+#endif
 };
 
 /** @brief A structure used to hold work until it can be processed. */
@@ -3604,6 +3785,17 @@ struct k_work_q {
 
 	/* Flags describing queue state. */
 	uint32_t flags;
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	/* Additional threads of a pool work queue. */
+	struct k_thread *pool_threads;
+
+	/* Number of additional threads in pool_threads. */
+	uint8_t num_pool_threads;
+
+	/* Number of work items being processed by the queue threads. */
+	uint8_t num_busy;
+#endif
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4293,6 +4485,66 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send a batch of messages to a message queue.
+ *
+ * This routine sends up to @a num_msgs messages, stored back to back at
+ * @a data, to message queue @a msgq while holding the queue lock once.
+ * Threads waiting to receive are handed a message each and are all
+ * readied before the caller is rescheduled; the remaining messages are
+ * copied into the ring buffer until it is full.
+ *
+ * The call only waits when no message at all can be sent, and then waits
+ * to send the first message only, as k_msgq_put() does.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Pointer to the messages.
+ * @param num_msgs Number of messages at @a data.
+ * @param timeout Non-negative waiting period to send the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages sent, which is less than @a num_msgs if the
+ *         queue filled up.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_put_many(struct k_msgq *msgq, const void *data,
+			      uint32_t num_msgs, k_timeout_t timeout);
+
+/**
+ * @brief Receive a batch of messages from a message queue.
+ *
+ * This routine receives up to @a num_msgs messages from message queue
+ * @a msgq into consecutive slots at @a data while holding the queue lock
+ * once. Threads waiting to send on a full queue fill the space that was
+ * freed and are all readied before the caller is rescheduled.
+ *
+ * The call only waits when the queue is empty, and then waits for a single
+ * message, as k_msgq_get() does.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold @a num_msgs received messages.
+ * @param num_msgs Maximum number of messages to receive.
+ * @param timeout Waiting period to receive the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages received.
+ * @retval -ENOMSG Returned without waiting.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+__syscall int k_msgq_get_many(struct k_msgq *msgq, void *data,
+			      uint32_t num_msgs, k_timeout_t timeout);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -4547,6 +4799,8 @@ struct k_pipe {
 	size_t         bytes_used;      /**< # bytes used in buffer */
 	size_t         read_index;      /**< Where in buffer to read from */
 	size_t         write_index;     /**< Where in buffer to write */
+	size_t         put_claim;       /**< # bytes claimed by writer */
+	size_t         get_claim;       /**< # bytes claimed by reader */
 	struct k_spinlock lock;		/**< Synchronization lock */
 
 	struct {
@@ -4554,6 +4808,8 @@ struct k_pipe {
 		_wait_q_t      writers; /**< Writer wait queue */
 	} wait_q;			/** Wait queue */
 
+	_POLL_EVENT;
+
 	uint8_t	       flags;		/**< Flags */
 };
 
@@ -4569,11 +4825,14 @@ struct k_pipe {
 	.bytes_used = 0,                                            \
 	.read_index = 0,                                            \
 	.write_index = 0,                                           \
+	.put_claim = 0,                                             \
+	.get_claim = 0,                                             \
 	.lock = {},                                                 \
 	.wait_q = {                                                 \
 		.readers = Z_WAIT_Q_INIT(&obj.wait_q.readers),       \
 		.writers = Z_WAIT_Q_INIT(&obj.wait_q.writers)        \
 	},                                                          \
+	_POLL_EVENT_OBJ_INIT(obj)                                   \
 	.flags = 0                                                  \
 	}
 
@@ -4710,6 +4969,84 @@ __syscall size_t k_pipe_read_avail(struct k_pipe *pipe);
  */
 __syscall size_t k_pipe_write_avail(struct k_pipe *pipe);
 
+/**
+ * @brief Claim space in a pipe's ring buffer for writing data in place.
+ *
+ * This routine provides direct access to a contiguous region of free space
+ * in the ring buffer of @a pipe, so a producer can generate data straight
+ * into the pipe instead of copying it in with k_pipe_put(). Once the data is
+ * written, k_pipe_put_finish() must be called to make it visible to readers.
+ *
+ * Fewer bytes than requested may be claimed when the free space wraps
+ * around the end of the ring buffer; a second claim returns the remainder.
+ * Only one write claim may be outstanding at a time, and k_pipe_put()
+ * must not be used on the pipe while it is.
+ *
+ * @note Only available to supervisor threads. The ring buffer of a pipe
+ * is not accessible to user mode.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of a pointer set to the start of the claimed region.
+ * @param size Requested number of bytes.
+ *
+ * @return Number of bytes claimed. Zero if the buffer is full, the pipe is
+ *         unbuffered or a write claim is already outstanding.
+ */
+size_t k_pipe_put_claim(struct k_pipe *pipe, uint8_t **data, size_t size);
+
+/**
+ * @brief Commit data written in place into a pipe's ring buffer.
+ *
+ * Completes the claim made with k_pipe_put_claim(). Readers waiting on the
+ * pipe are served from the committed data and poll events are signalled.
+ * Committing fewer bytes than were claimed releases the rest of the claim.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes written, at most the size of the claim.
+ *
+ * @retval 0 Data committed.
+ * @retval -EINVAL No claim outstanding or @a size exceeds the claim.
+ */
+int k_pipe_put_finish(struct k_pipe *pipe, size_t size);
+
+/**
+ * @brief Claim data in a pipe's ring buffer for reading in place.
+ *
+ * This routine provides direct access to a contiguous region of data held
+ * in the ring buffer of @a pipe, so a consumer can process it without
+ * copying it out with k_pipe_get(). k_pipe_get_finish() must be called to
+ * release the space once the data has been consumed.
+ *
+ * Fewer bytes than requested may be claimed when the data wraps around the
+ * end of the ring buffer. Only one read claim may be outstanding at a time,
+ * and k_pipe_get() must not be used on the pipe while it is.
+ *
+ * @note Only available to supervisor threads.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of a pointer set to the start of the claimed region.
+ * @param size Requested number of bytes.
+ *
+ * @return Number of bytes claimed. Zero if the buffer is empty, the pipe is
+ *         unbuffered or a read claim is already outstanding.
+ */
+size_t k_pipe_get_claim(struct k_pipe *pipe, uint8_t **data, size_t size);
+
+/**
+ * @brief Release data read in place from a pipe's ring buffer.
+ *
+ * Completes the claim made with k_pipe_get_claim(). Writers waiting on a
+ * full pipe are moved into the freed space. Releasing fewer bytes than were
+ * claimed leaves the rest in the pipe.
+ *
+ * @param pipe Address of the pipe.
+ * @param size Number of bytes consumed, at most the size of the claim.
+ *
+ * @retval 0 Space released.
+ * @retval -EINVAL No claim outstanding or @a size exceeds the claim.
+ */
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size);
+
 /** @} */
 
 /**
@@ -5104,6 +5441,9 @@ enum _poll_types_bits {
 	/* msgq data availability */
 	_POLL_TYPE_MSGQ_DATA_AVAILABLE,
 
+	/* pipe data availability */
+	_POLL_TYPE_PIPE_DATA_AVAILABLE,
+
 	_POLL_NUM_TYPES
 };
 
@@ -5129,6 +5469,9 @@ enum _poll_states_bits {
 	/* data is available to read on a message queue */
 	_POLL_STATE_MSGQ_DATA_AVAILABLE,
 
+	/* data is available to read from a pipe */
+	_POLL_STATE_PIPE_DATA_AVAILABLE,
+
 	_POLL_NUM_STATES
 };
 
@@ -5160,6 +5503,7 @@ enum _poll_states_bits {
 #define K_POLL_TYPE_DATA_AVAILABLE Z_POLL_TYPE_BIT(_POLL_TYPE_DATA_AVAILABLE)
 #define K_POLL_TYPE_FIFO_DATA_AVAILABLE K_POLL_TYPE_DATA_AVAILABLE
 #define K_POLL_TYPE_MSGQ_DATA_AVAILABLE Z_POLL_TYPE_BIT(_POLL_TYPE_MSGQ_DATA_AVAILABLE)
+#define K_POLL_TYPE_PIPE_DATA_AVAILABLE Z_POLL_TYPE_BIT(_POLL_TYPE_PIPE_DATA_AVAILABLE)
 
 /* public - polling modes */
 enum k_poll_modes {
@@ -5176,6 +5520,7 @@ enum k_poll_modes {
 #define K_POLL_STATE_DATA_AVAILABLE Z_POLL_STATE_BIT(_POLL_STATE_DATA_AVAILABLE)
 #define K_POLL_STATE_FIFO_DATA_AVAILABLE K_POLL_STATE_DATA_AVAILABLE
 #define K_POLL_STATE_MSGQ_DATA_AVAILABLE Z_POLL_STATE_BIT(_POLL_STATE_MSGQ_DATA_AVAILABLE)
+#define K_POLL_STATE_PIPE_DATA_AVAILABLE Z_POLL_STATE_BIT(_POLL_STATE_PIPE_DATA_AVAILABLE)
 #define K_POLL_STATE_CANCELLED Z_POLL_STATE_BIT(_POLL_STATE_CANCELLED)
 
 /* public - poll signal object */
@@ -5233,6 +5578,7 @@ struct k_poll_event {
 		struct k_fifo *fifo;
 		struct k_queue *queue;
 		struct k_msgq *msgq;
+		struct k_pipe *pipe;
 	};
 };
 
@@ -5261,6 +5607,30 @@ struct k_poll_event {
 	}, \
 	}
 
+/**
+ * @brief Persistent set of poll events
+ *
+ * A poll set keeps its events registered with their objects across calls
+ * to k_poll_set_wait(). Only events that were returned by the previous
+ * wait are registered again, so the cost of a wait does not grow with the
+ * number of events in the set.
+ */
+struct k_poll_set {
+	/** @cond INTERNAL_HIDDEN */
+	struct z_poller poller;
+	struct k_thread *owner;
+	struct k_poll_event *events;
+	int num_events;
+	/* signalled events not yet returned to the owner */
+	sys_dlist_t ready;
+	/* returned events waiting to be registered again */
+	sys_dlist_t idle;
+	/* protects the lists, taken by objects signalling an event */
+	struct k_spinlock lock;
+	_wait_q_t wait_q;
+	/** @endcond */
+};
+
 /**
  * @brief Initialize one struct k_poll_event instance
  *
@@ -5327,6 +5697,62 @@ extern void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 __syscall int k_poll(struct k_poll_event *events, int num_events,
 		     k_timeout_t timeout);
 
+/**
+ * @brief Initialize a persistent poll set.
+ *
+ * The events must have been initialized with k_poll_event_init() or one of
+ * the static initializers and must stay valid, and not be passed to
+ * k_poll(), until k_poll_set_cleanup() is called. They are registered with
+ * their objects by the first call to k_poll_set_wait().
+ *
+ * A poll set is meant to be waited on by a single thread. It is only
+ * available to supervisor threads.
+ *
+ * @param set The poll set to initialize.
+ * @param events An array of events to be polled for.
+ * @param num_events The number of events in the array.
+ *
+ * @return N/A
+ */
+void k_poll_set_init(struct k_poll_set *set, struct k_poll_event *events,
+		     int num_events);
+
+/**
+ * @brief Wait for events of a persistent poll set to occur
+ *
+ * Registers the events returned by the previous wait again, then waits for
+ * at least one event of @a set to be ready. Unlike k_poll(), only the ready
+ * events are reported: pointers to them are stored in @a ready and their
+ * state field tells which condition was met. Events that were not returned
+ * remain registered and are reported by a later wait. Event states are
+ * reset when the event is registered again.
+ *
+ * As with k_poll(), readiness only indicates that the object was available
+ * when the event was signalled; the object has to be acquired separately.
+ *
+ * @param set The poll set.
+ * @param ready Array filled with pointers to the ready events.
+ * @param max_ready Size of @a ready.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of events stored in @a ready.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max_ready, k_timeout_t timeout);
+
+/**
+ * @brief Remove all registrations of a persistent poll set
+ *
+ * After this call the events of @a set can be reused or released.
+ *
+ * @param set The poll set.
+ *
+ * @return N/A
+ */
+void k_poll_set_cleanup(struct k_poll_set *set);
+
 /**
  * @brief Initialize a poll signal object.
  *
@@ -5624,6 +6050,51 @@ int k_thread_runtime_stats_get(k_tid_t thread,
  */
 int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats);
 
+#ifdef CONFIG_SCHED_THREAD_STATS
+
+/**
+ * @brief Run queue statistics
+ *
+ * On SMP, threads running on a CPU are not in the run queue.
+ */
+struct k_sched_runq_stats {
+	/** Number of threads currently in the run queue */
+	uint32_t depth;
+	/** Highest number of threads seen in the run queue */
+	uint32_t max_depth;
+};
+
+/**
+ * @brief Get the scheduling statistics of a thread
+ *
+ * @param thread ID of thread.
+ * @param stats Pointer to struct to copy statistics into.
+ * @return -EINVAL if null pointers, otherwise 0
+ */
+int k_thread_sched_stats_get(k_tid_t thread,
+			     struct k_thread_sched_stats *stats);
+
+/**
+ * @brief Get the scheduling statistics of a CPU
+ *
+ * The CPU utilization is busy_cycles / (idle_cycles + busy_cycles).
+ *
+ * @param cpu CPU index.
+ * @param stats Pointer to struct to copy statistics into.
+ * @return -EINVAL if null pointer or invalid CPU index, otherwise 0
+ */
+int k_cpu_sched_stats_get(int cpu, struct k_cpu_sched_stats *stats);
+
+/**
+ * @brief Get the run queue statistics
+ *
+ * @param stats Pointer to struct to copy statistics into.
+ * @return -EINVAL if null pointer, otherwise 0
+ */
+int k_sched_runq_stats_get(struct k_sched_runq_stats *stats);
+
+#endif /* CONFIG_SCHED_THREAD_STATS */
+
 #endif
 
 #ifdef __cplusplus
@@ -155,6 +155,19 @@ struct _mem_domain_info {
 	struct k_mem_domain *mem_domain;
 };
 
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE
+struct z_object;
+
+/* Dynamic kernel objects last looked up by a thread */
+struct _dyn_obj_cache {
+	/** Object removal count the entries are valid for */
+	uint32_t generation;
+	struct {
+		const void *obj;
+		struct z_object *ko;
+	} entries[CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE_SIZE];
+};
+#endif /* CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE */
 #endif /* CONFIG_USERSPACE */
 
 #ifdef CONFIG_THREAD_USERSPACE_LOCAL_DATA
@@ -165,6 +178,50 @@ struct _thread_userspace_local_data {
 };
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_RESERVATION
+/* Statistics of a deadline reservation, see
+ * k_thread_reservation_stats_get()
+ */
+struct k_thread_reservation_stats {
+	/* Number of jobs completed */
+	uint32_t jobs;
+
+	/* Number of jobs completed after their deadline */
+	uint32_t misses;
+
+	/* Number of times the budget ran out before the job completed */
+	uint32_t overruns;
+};
+
+struct _thread_reservation {
+	/* Budget enforcement, armed while the thread runs */
+	struct _timeout budget_timeout;
+
+	/* Runtime and period, in cycles, 0 when not reserved */
+	uint32_t runtime;
+	uint32_t period;
+
+	/* Utilization, in parts per million */
+	uint32_t util;
+
+	/* Budget left to the current job, in cycles */
+	uint32_t budget;
+
+	/* Release time of the current job, in cycles */
+	uint32_t release;
+
+	/* Deadline the thread is scheduled with, in cycles, later than the
+	 * end of the period of the current job after budget overruns
+	 */
+	uint32_t deadline;
+
+	/* Timestamp when last switched in */
+	uint32_t switched_in;
+
+	struct k_thread_reservation_stats stats;
+};
+#endif
+
 #ifdef CONFIG_THREAD_RUNTIME_STATS
 struct k_thread_runtime_stats {
 	/* Thread execution cycles */
@@ -177,6 +234,27 @@ struct k_thread_runtime_stats {
 
 typedef struct k_thread_runtime_stats k_thread_runtime_stats_t;
 
+#ifdef CONFIG_SCHED_THREAD_STATS
+/* Scheduling statistics of a thread, see k_thread_sched_stats_get() */
+struct k_thread_sched_stats {
+	/* Number of times the thread was switched in */
+	uint32_t switches;
+
+	/* Longest wakeup latency, in cycles */
+	uint32_t max_wakeup_latency;
+
+	/* Cycles spent ready to run but not running */
+	uint64_t ready_cycles;
+
+	/* Wakeup latencies, from being made ready after pending, sleeping
+	 * or being started to being switched in. Bucket 0 counts latencies
+	 * below 1 us, bucket n those from 2^(n-1) us to below 2^n us, and
+	 * the last bucket all the longer ones.
+	 */
+	uint32_t wakeup_hist[CONFIG_SCHED_THREAD_STATS_HIST_BUCKETS];
+};
+#endif /* CONFIG_SCHED_THREAD_STATS */
+
 struct _thread_runtime_stats {
 	/* Timestamp when last switched in */
 #ifdef CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS
@@ -186,6 +264,19 @@ struct _thread_runtime_stats {
 #endif
 
 	k_thread_runtime_stats_t stats;
+
+#ifdef CONFIG_SCHED_THREAD_STATS
+	/* Timestamp when made ready to run, valid while ready is set */
+	uint32_t ready_since;
+
+	/* True while ready to run but not yet switched in */
+	bool ready;
+
+	/* True when made ready by a wakeup rather than a preemption */
+	bool woken;
+
+	struct k_thread_sched_stats sched_stats;
+#endif
 };
 #endif
 
@@ -256,6 +347,10 @@ struct k_thread {
 	k_thread_stack_t *stack_obj;
 	/** current syscall frame pointer */
 	void *syscall_frame;
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE
+	/** dynamic kernel object lookup cache */
+	struct _dyn_obj_cache dyn_obj_cache;
+#endif
 #endif /* CONFIG_USERSPACE */
 
 
@@ -283,6 +378,11 @@ struct k_thread {
 	struct _thread_runtime_stats rt_stats;
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_RESERVATION
+	/** Deadline reservation */
+	struct _thread_reservation reservation;
+#endif
+
 #ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
 	/** Paging statistics */
 	struct k_mem_paging_stats_t paging_stats;
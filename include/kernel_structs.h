@@ -97,6 +97,20 @@ struct _ready_q {
 
 typedef struct _ready_q _ready_q_t;
 
+#ifdef CONFIG_SCHED_THREAD_STATS
+/* Scheduling statistics of a CPU, see k_cpu_sched_stats_get() */
+struct k_cpu_sched_stats {
+	/* Number of context switches */
+	uint32_t switches;
+
+	/* Time spent running the idle thread and other threads, in the
+	 * unit of the thread runtime statistics
+	 */
+	uint64_t idle_cycles;
+	uint64_t busy_cycles;
+};
+#endif
+
 struct _cpu {
 	/* nested interrupt count */
 	uint32_t nested;
@@ -127,6 +141,11 @@ struct _cpu {
 	uint8_t swap_ok;
 #endif
 
+#ifdef CONFIG_SCHED_THREAD_STATS
+	/* Scheduling statistics, see k_cpu_sched_stats_get() */
+	struct k_cpu_sched_stats sched_stats;
+#endif
+
 	/* Per CPU architecture specifics */
 	struct _cpu_arch arch;
 };
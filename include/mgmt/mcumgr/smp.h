@@ -81,6 +81,14 @@ struct zephyr_smp_transport {
 	/* FIFO containing incoming requests to be processed. */
 	struct k_fifo zst_fifo;
 
+	/* Room for requests received ahead of processing. */
+	struct k_sem zst_window;
+
+#ifdef CONFIG_MCUMGR_SMP_REORDER
+	/* Sequence number expected in the next request. */
+	uint8_t zst_seq;
+#endif
+
 	zephyr_smp_transport_out_fn *zst_output;
 	zephyr_smp_transport_get_mtu_fn *zst_get_mtu;
 	zephyr_smp_transport_ud_copy_fn *zst_ud_copy;
@@ -104,6 +112,22 @@ void zephyr_smp_transport_init(struct zephyr_smp_transport *zst,
 			       zephyr_smp_transport_ud_copy_fn *ud_copy_func,
 			       zephyr_smp_transport_ud_free_fn *ud_free_func);
 
+/**
+ * @brief Allocates a buffer for an incoming SMP request packet.
+ *
+ * Waits for room in the window of the transport, see
+ * CONFIG_MCUMGR_SMP_WINDOW.  The room is given back once the request has been
+ * processed, the buffer must be passed to zephyr_smp_rx_req().
+ *
+ * @param zst                   The transport receiving the request.
+ * @param timeout               Time to wait for room in the window.
+ *
+ * @return                      The buffer on success;
+ *                              NULL if the window or the buffer pool is full.
+ */
+struct net_buf *zephyr_smp_rx_buf_alloc(struct zephyr_smp_transport *zst,
+					k_timeout_t timeout);
+
 /**
  * @brief Enqueues an incoming SMP request packet for processing.
  *
@@ -632,6 +632,39 @@ union shell_internal {
 	struct shell_flags flags;
 };
 
+#if defined CONFIG_SHELL_BINARY_MODE
+/**
+ * @brief Binary frame handler.
+ *
+ * Called from the shell thread for each frame received in binary mode. An
+ * empty frame (@p data NULL, @p len 0) is passed when the host leaves
+ * binary mode.
+ *
+ * @param[in] shell	Pointer to the shell instance.
+ * @param[in] data	Frame payload.
+ * @param[in] len	Frame payload length.
+ * @param[in] user_data	User data given to shell_binary_mode_enter().
+ *
+ * @return 0 to stay in binary mode, any other value to go back to text mode.
+ */
+typedef int (*shell_binary_handler_t)(const struct shell *shell,
+				      const uint8_t *data, size_t len,
+				      void *user_data);
+
+/**
+ * @internal @brief Binary mode context.
+ */
+struct shell_binary_ctx {
+	shell_binary_handler_t handler; /*!< Set while in binary mode.*/
+	void *user_data;
+	bool active; /*!< Binary mode acknowledged to the host.*/
+	uint8_t hdr_len; /*!< Frame header bytes received.*/
+	uint16_t len; /*!< Frame payload length.*/
+	uint16_t cnt; /*!< Frame payload bytes received.*/
+	uint8_t buf[CONFIG_SHELL_BINARY_FRAME_SIZE];
+};
+#endif /* CONFIG_SHELL_BINARY_MODE */
+
 enum shell_signal {
 	SHELL_SIGNAL_RXRDY,
 	SHELL_SIGNAL_LOG_MSG,
@@ -682,6 +715,11 @@ struct shell_ctx {
 	/*!< Printf buffer size.*/
 	char printf_buff[CONFIG_SHELL_PRINTF_BUFF_SIZE];
 
+#if defined CONFIG_SHELL_BINARY_MODE
+	/*!< Binary frame mode context.*/
+	struct shell_binary_ctx binary;
+#endif
+
 	volatile union shell_internal internal; /*!< Internal shell data.*/
 
 	struct k_poll_signal signals[SHELL_SIGNALS];
@@ -1107,6 +1145,50 @@ int shell_obscure_set(const struct shell *shell, bool obscure);
  */
 int shell_mode_delete_set(const struct shell *shell, bool val);
 
+#if defined CONFIG_SHELL_BINARY_MODE
+/** Start of a binary mode frame, followed by the little endian length. */
+#define SHELL_BINARY_FRAME_START 0xA5
+
+/**
+ * @brief Switch the shell to binary frame mode.
+ *
+ * Must be called from a command handler executed from the shell input. Once
+ * the command returns, the shell sends a frame holding the maximum frame
+ * payload length (16 bits, little endian) to acknowledge the mode switch.
+ * The host then sends frames made of SHELL_BINARY_FRAME_START, the payload
+ * length (16 bits, little endian) and the payload. Frames are not echoed and
+ * bytes outside of frames are ignored. An empty frame switches back to text
+ * mode.
+ *
+ * Output from other threads is dropped and log messages are held while in
+ * binary mode.
+ *
+ * @param[in] shell	Pointer to the shell instance.
+ * @param[in] handler	Called for each received frame.
+ * @param[in] user_data	Passed to @p handler.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if not called from a command handler.
+ * @retval -EBUSY if the shell is already in binary mode.
+ */
+int shell_binary_mode_enter(const struct shell *shell,
+			    shell_binary_handler_t handler, void *user_data);
+
+/**
+ * @brief Send a frame to the host in binary mode.
+ *
+ * @param[in] shell	Pointer to the shell instance.
+ * @param[in] data	Frame payload.
+ * @param[in] len	Frame payload length.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p len does not fit in a frame.
+ * @retval -ENOTSUP if the shell is not in binary mode.
+ */
+int shell_binary_write(const struct shell *shell, const void *data,
+		       size_t len);
+#endif /* CONFIG_SHELL_BINARY_MODE */
+
 /**
  * @}
  */
@@ -21,6 +21,7 @@
  */
 
 #include <stdbool.h>
+#include <kernel.h>
 #include <drivers/flash.h>
 
 #ifdef __cplusplus
@@ -62,6 +63,13 @@ struct stream_flash_ctx {
 #ifdef CONFIG_STREAM_FLASH_ERASE
 	off_t last_erased_page_start_offset; /* Last erased offset */
 #endif
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	struct k_work erase_work; /* Erases pages ahead of the writes */
+	struct k_mutex lock; /* Serializes erases ahead with the writes */
+	off_t erased_start; /* Start of the erased range being written */
+	off_t erased_end; /* End of the erased range being written */
+	uint8_t erase_ahead; /* Pages erased ahead, 0 when disabled */
+#endif
 };
 
 /**
@@ -78,6 +86,9 @@ struct stream_flash_ctx {
  *             of the flash device minus the offset.
  * @param cb Callback to be invoked on completed flash write operations.
  *
+ * @note A context with erase ahead enabled must be flushed before being
+ * initialized again.
+ *
  * @return non-negative on success, negative errno code on fail
  */
 int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
@@ -108,6 +119,8 @@ size_t stream_flash_bytes_written(struct stream_flash_ctx *ctx);
  *        A flush write should be the last write operation in a sequence of
  *        write operations for given context (although this is not mandatory
  *        if the total data size is a multiple of the buffer size).
+ *        It also stops erasing pages ahead of the writes, the pages already
+ *        erased ahead stay erased.
  *
  * @return non-negative on success, negative errno code on fail
  */
@@ -128,6 +141,23 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
  */
 int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off);
 
+/**
+ * @brief Erase pages ahead of the writes.
+ *
+ * After each write to flash, the @p pages pages following the one being
+ * written are erased in the background, so that the next writes do not wait
+ * for an erase. The pages erased ahead are within the area given to
+ * @ref stream_flash_init, but they can be past the data finally written.
+ *
+ * @note Requires CONFIG_STREAM_FLASH_ERASE_AHEAD.
+ *
+ * @param ctx context
+ * @param pages Number of pages erased ahead, 0 to stop.
+ *
+ * @return non-negative on success, negative errno code on fail
+ */
+int stream_flash_erase_ahead(struct stream_flash_ctx *ctx, uint8_t pages);
+
 /**
  * @brief Load persistent stream write progress stored with key
  *        @p settings_key .
@@ -214,6 +214,85 @@ int cbvprintf_package(void *packaged,
 		      const char *format,
 		      va_list ap);
 
+/** @brief Package a formatted string using a build time argument descriptor.
+ *
+ * Like cbprintf_package() but the argument list is not discovered by
+ * scanning the format string. Instead, type of each argument is classified
+ * at compile time and stored in a constant descriptor which is walked when
+ * the package is built.
+ *
+ * Character pointer arguments are treated as strings (%s). Arguments that
+ * are character pointers used with another conversion (e.g. %p) must be
+ * cast to void pointer.
+ *
+ * If _Generic is not supported then cbprintf_package() is used.
+ *
+ * @param packaged pointer to where the packaged data can be stored. See
+ * cbprintf_package().
+ *
+ * @param len number of bytes available at @p packaged or buffer alignment
+ * offset if @p packaged is null. See cbprintf_package().
+ *
+ * @param ... formatted string with arguments.
+ *
+ * @return same values as cbprintf_package().
+ */
+#define CBPRINTF_PACKAGE_DESC(packaged, len, ... /* fmt, ... */) \
+	Z_CBPRINTF_PACKAGE_DESC(packaged, len, __VA_ARGS__)
+
+/** @brief Capture state required to output formatted data later using
+ * an argument descriptor.
+ *
+ * Function is typically used through CBPRINTF_PACKAGE_DESC() which generates
+ * the descriptor at build time.
+ *
+ * @param packaged pointer to where the packaged data can be stored. See
+ * cbprintf_package().
+ *
+ * @param len number of bytes available at @p packaged or buffer alignment
+ * offset if @p packaged is null. See cbprintf_package().
+ *
+ * @param desc argument descriptor. One Z_CBPRINTF_ARG_* entry for the
+ * format string followed by one entry for each argument.
+ *
+ * @param desc_len number of entries in @p desc.
+ *
+ * @param format a standard ISO C format string with characters and conversion
+ * specifications.
+ *
+ * @param ... arguments corresponding to the entries of @p desc.
+ *
+ * @return same values as cbprintf_package().
+ */
+__printf_like(5, 6)
+int cbprintf_package_desc(void *packaged, size_t len,
+			  const uint8_t *desc, size_t desc_len,
+			  const char *format, ...);
+
+/** @brief Capture state required to output formatted data later using
+ * an argument descriptor.
+ *
+ * See cbprintf_package_desc().
+ *
+ * @param packaged pointer to where the packaged data can be stored.
+ *
+ * @param len number of bytes available at @p packaged or buffer alignment
+ * offset if @p packaged is null.
+ *
+ * @param desc argument descriptor.
+ *
+ * @param desc_len number of entries in @p desc.
+ *
+ * @param format format string.
+ *
+ * @param ap captured stack arguments corresponding to the entries of @p desc.
+ *
+ * @return same values as cbprintf_package().
+ */
+int cbvprintf_package_desc(void *packaged, size_t len,
+			   const uint8_t *desc, size_t desc_len,
+			   const char *format, va_list ap);
+
 /** @brief Generate the output for a previously captured format
  * operation.
  *
@@ -194,5 +194,66 @@ static inline size_t z_cbprintf_cxx_alignment(T arg)
 	return MAX(__alignof__(arg), VA_STACK_MIN_ALIGN);
 }
 
+/* C++ version for classifying argument type in a package descriptor.
+ * Classification is done on the promoted type so it is usable in constant
+ * expressions.
+ */
+template < typename T >
+struct z_cbprintf_cxx_arg_type {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_PTR;
+};
+
+template < > struct z_cbprintf_cxx_arg_type<int> {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_INT;
+};
+
+template < > struct z_cbprintf_cxx_arg_type<unsigned int> {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_INT;
+};
+
+template < > struct z_cbprintf_cxx_arg_type<long> {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_LONG;
+};
+
+template < > struct z_cbprintf_cxx_arg_type<unsigned long> {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_LONG;
+};
+
+template < > struct z_cbprintf_cxx_arg_type<long long> {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_LONG_LONG;
+};
+
+template < > struct z_cbprintf_cxx_arg_type<unsigned long long> {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_LONG_LONG;
+};
+
+template < > struct z_cbprintf_cxx_arg_type<float> {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_DOUBLE;
+};
+
+template < > struct z_cbprintf_cxx_arg_type<double> {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_DOUBLE;
+};
+
+template < > struct z_cbprintf_cxx_arg_type<long double> {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_LONG_DOUBLE;
+};
+
+template < > struct z_cbprintf_cxx_arg_type<char *> {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_STR;
+};
+
+template < > struct z_cbprintf_cxx_arg_type<const char *> {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_STR;
+};
+
+template < > struct z_cbprintf_cxx_arg_type<volatile char *> {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_STR;
+};
+
+template < > struct z_cbprintf_cxx_arg_type<const volatile char *> {
+	static constexpr uint8_t value = Z_CBPRINTF_ARG_STR;
+};
+
 #endif /* __cplusplus */
 #endif /* ZEPHYR_INCLUDE_SYS_CBPRINTF_CXX_H_ */
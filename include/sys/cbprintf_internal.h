@@ -52,6 +52,18 @@ static inline void z_cbprintf_wcpy(int *dst, int *src, size_t len)
 	}
 }
 
+/*
+ * Argument classes stored in a package descriptor. Each class determines
+ * size and alignment of the argument in the package.
+ */
+#define Z_CBPRINTF_ARG_INT		0
+#define Z_CBPRINTF_ARG_LONG		1
+#define Z_CBPRINTF_ARG_LONG_LONG	2
+#define Z_CBPRINTF_ARG_DOUBLE		3
+#define Z_CBPRINTF_ARG_LONG_DOUBLE	4
+#define Z_CBPRINTF_ARG_PTR		5
+#define Z_CBPRINTF_ARG_STR		6
+
 #include <sys/cbprintf_cxx.h>
 
 #ifdef __cplusplus
@@ -273,6 +285,37 @@ extern "C" {
 	_align_offset += _arg_size; \
 } while (0)
 
+/** @brief Get descriptor class of the argument.
+ *
+ * Classification is a constant expression so it can be used to initialize
+ * a static descriptor table. Character pointers are classified as strings.
+ *
+ * @param v argument.
+ *
+ * @return One of Z_CBPRINTF_ARG_* values.
+ */
+#ifdef __cplusplus
+#define Z_CBPRINTF_ARG_TYPE(v) z_cbprintf_cxx_arg_type<decltype((v) + 0)>::value
+#else
+#define Z_CBPRINTF_ARG_TYPE(v) \
+	_Generic((v) + 0, \
+		int : Z_CBPRINTF_ARG_INT, \
+		unsigned int : Z_CBPRINTF_ARG_INT, \
+		long : Z_CBPRINTF_ARG_LONG, \
+		unsigned long : Z_CBPRINTF_ARG_LONG, \
+		long long : Z_CBPRINTF_ARG_LONG_LONG, \
+		unsigned long long : Z_CBPRINTF_ARG_LONG_LONG, \
+		float : Z_CBPRINTF_ARG_DOUBLE, \
+		double : Z_CBPRINTF_ARG_DOUBLE, \
+		long double : Z_CBPRINTF_ARG_LONG_DOUBLE, \
+		char * : Z_CBPRINTF_ARG_STR, \
+		const char * : Z_CBPRINTF_ARG_STR, \
+		volatile char * : Z_CBPRINTF_ARG_STR, \
+		const volatile char * : Z_CBPRINTF_ARG_STR, \
+		default : \
+			Z_CBPRINTF_ARG_PTR)
+#endif
+
 /** @brief Package single argument.
  *
  * Macro is called in a loop for each argument in the string.
@@ -388,6 +431,23 @@ do { \
 } while (0)
 #endif /* Z_C_GENERIC */
 
+#if Z_C_GENERIC
+#define Z_CBPRINTF_PACKAGE_DESC(packaged, len, ... /* fmt, ... */) ({ \
+	_Pragma("GCC diagnostic push") \
+	_Pragma("GCC diagnostic ignored \"-Wpointer-arith\"") \
+	static const uint8_t _desc[] = { \
+		FOR_EACH(Z_CBPRINTF_ARG_TYPE, (,), __VA_ARGS__) \
+	}; \
+	_Pragma("GCC diagnostic pop") \
+	int _rv = cbprintf_package_desc(packaged, len, _desc, sizeof(_desc), \
+					__VA_ARGS__); \
+	_rv; \
+})
+#else
+#define Z_CBPRINTF_PACKAGE_DESC(packaged, len, ... /* fmt, ... */) \
+	cbprintf_package(packaged, len, __VA_ARGS__)
+#endif /* Z_C_GENERIC */
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,7 +14,7 @@ extern "C" {
 #endif
 
 struct k_thread;
-struct k_mutex;
+struct z_sys_mutex_data;
 struct z_futex_data;
 
 /**
@@ -59,8 +59,8 @@ struct z_stack_data {
 
 /* Object extra data. Only some objects use this, determined by object type */
 union z_object_data {
-	/* Backing mutex for K_OBJ_SYS_MUTEX */
-	struct k_mutex *mutex;
+	/* Backing mutex and contention state for K_OBJ_SYS_MUTEX */
+	struct z_sys_mutex_data *sys_mutex_data;
 
 	/* Numerical thread ID for K_OBJ_THREAD */
 	unsigned int thread_id;
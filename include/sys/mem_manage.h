@@ -104,7 +104,17 @@ struct k_mem_paging_stats_t {
 
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
+
+		/** Number of pages evicted in a batch ahead of need,
+		 * included in the counts above
+		 */
+		unsigned long			batched;
 	} eviction;
+
+	struct {
+		/** Number of pages paged in ahead of a page fault */
+		unsigned long			pages;
+	} read_ahead;
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -659,6 +669,54 @@ void k_mem_paging_backing_store_page_finalize(struct z_page_frame *pf,
  */
 void k_mem_paging_backing_store_init(void);
 
+/** Statistics of the compressed RAM backing store */
+struct k_mem_paging_backing_store_compressed_stats {
+	/** Number of pages currently stored */
+	unsigned long	pages_stored;
+
+	/** Pool memory currently used by stored pages, in bytes */
+	unsigned long	bytes_used;
+
+	/** Number of pages paged out */
+	unsigned long	page_outs;
+
+	/** Number of paged out pages consisting only of zeroes */
+	unsigned long	zero_pages;
+
+	/** Number of paged out pages stored compressed */
+	unsigned long	lz4_pages;
+
+	/** Number of paged out pages stored uncompressed */
+	unsigned long	raw_pages;
+
+	/** Bytes paged out, before compression. The ratio of this to
+	 * @a bytes_out is the compression ratio.
+	 */
+	uint64_t	bytes_in;
+
+	/** Bytes paged out, after compression */
+	uint64_t	bytes_out;
+
+	/** Number of pages paged in */
+	unsigned long	page_ins;
+
+	/** Total time spent paging in, in hardware cycles */
+	uint64_t	page_in_cycles;
+
+	/** Longest time spent paging in a page, in hardware cycles */
+	uint32_t	page_in_cycles_max;
+};
+
+/**
+ * Get the statistics of the compressed RAM backing store
+ *
+ * Only available with CONFIG_BACKING_STORE_COMPRESSED_RAM.
+ *
+ * @param[out] stats Statistics struct to be filled.
+ */
+void k_mem_paging_backing_store_compressed_stats_get(
+	struct k_mem_paging_backing_store_compressed_stats *stats);
+
 /** @} */
 
 #ifdef __cplusplus
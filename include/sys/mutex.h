@@ -11,9 +11,13 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
- * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
+ * With userspace and CONFIG_SYS_MUTEX_FAST_PATH enabled, uncontended
+ * sys_mutexes are locked and unlocked with atomic ops on the owner ID stored
+ * in the mutex, without a syscall. The owner ID is the current thread ID
+ * kept in thread local storage.
+ * Once a second thread needs the mutex, ownership is arbitrated by a
+ * backing k_mutex in the kernel, which provides priority inheritance,
+ * similar to Linux's FUTEX_LOCK_PI and FUTEX_UNLOCK_PI.
  */
 
 #ifdef __cplusplus
@@ -21,18 +25,25 @@ extern "C" {
 #endif
 
 #ifdef CONFIG_USERSPACE
+#include <kernel.h>
 #include <sys/atomic.h>
 #include <zephyr/types.h>
 #include <sys_clock.h>
 
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
+	/* Thread ID of the owner, or 0 if the mutex is free. The
+	 * Z_SYS_MUTEX_CONTENDED bit is set while the kernel arbitrates
+	 * ownership, in which case the mutex is released through the kernel.
 	 */
 	atomic_t val;
+
+	/* Recursive lock count, only accessed by the owner */
+	uint32_t lock_count;
 };
 
+/* Thread IDs are word aligned, so the low bit is free for this flag */
+#define Z_SYS_MUTEX_CONTENDED 1
+
 /**
  * @defgroup user_mutex_apis User mode mutex APIs
  * @ingroup kernel_apis
@@ -103,7 +114,26 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	atomic_val_t self = (atomic_val_t)z_tls_current;
+	atomic_val_t owner_id;
+
+	if (atomic_cas(&mutex->val, 0, self)) {
+		mutex->lock_count = 1U;
+		return 0;
+	}
+
+	owner_id = atomic_get(&mutex->val) & ~Z_SYS_MUTEX_CONTENDED;
+	if (owner_id == self) {
+		mutex->lock_count++;
+		return 0;
+	}
+
+	if (owner_id != 0 && K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		return -EBUSY;
+	}
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
+
 	return z_sys_mutex_kernel_lock(mutex, timeout);
 }
 
@@ -126,7 +156,25 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FAST_PATH
+	atomic_val_t self = (atomic_val_t)z_tls_current;
+
+	if (mutex->lock_count > 1U &&
+	    (atomic_get(&mutex->val) & ~Z_SYS_MUTEX_CONTENDED) == self) {
+		mutex->lock_count--;
+		return 0;
+	}
+
+	if (atomic_get(&mutex->val) == self) {
+		mutex->lock_count = 0U;
+		if (atomic_cas(&mutex->val, self, 0)) {
+			return 0;
+		}
+		/* contended meanwhile, restore the count for the kernel */
+		mutex->lock_count = 1U;
+	}
+#endif /* CONFIG_SYS_MUTEX_FAST_PATH */
+
 	return z_sys_mutex_kernel_unlock(mutex);
 }
 
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+#define ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <syscall.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup syscall_batch_apis System Call Batching APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @brief A system call to be run as part of a batch
+ *
+ * The arguments are the ones of the system call as passed to its
+ * marshalling function: 64-bit arguments, including k_timeout_t when
+ * CONFIG_TIMEOUT_64BIT is enabled, take two consecutive words on 32-bit
+ * systems, see K_SYSCALL_OP_ARG64() and K_SYSCALL_OP_TIMEOUT(). A 64-bit
+ * return value is written to a uint64_t pointed to by one more argument.
+ * System calls with more than six argument words take the sixth and
+ * following ones from an array pointed to by the last argument.
+ */
+struct k_syscall_op {
+	/** System call id, one of the K_SYSCALL_* values */
+	uintptr_t id;
+	/** System call arguments */
+	uintptr_t args[6];
+	/** Return value of the system call, set when the batch has run */
+	uintptr_t ret;
+};
+
+/**
+ * @brief Statically initialize a batched system call
+ *
+ * @param call_id System call id, for example K_SYSCALL_K_SEM_GIVE
+ * @param ... System call arguments, cast to uintptr_t
+ */
+#define K_SYSCALL_OP(call_id, ...) \
+	{ .id = (call_id), .args = { __VA_ARGS__ } }
+
+/**
+ * @brief System call argument words for a 64-bit value
+ *
+ * @param v 64-bit argument
+ */
+#ifdef CONFIG_64BIT
+#define K_SYSCALL_OP_ARG64(v) (uintptr_t)(v)
+#else
+#define K_SYSCALL_OP_ARG64(v) \
+	(uintptr_t)(uint64_t)(v), (uintptr_t)((uint64_t)(v) >> 32)
+#endif
+
+/**
+ * @brief System call argument words for a k_timeout_t
+ *
+ * @param t Timeout
+ */
+#ifdef CONFIG_TIMEOUT_64BIT
+#define K_SYSCALL_OP_TIMEOUT(t) K_SYSCALL_OP_ARG64((t).ticks)
+#else
+#define K_SYSCALL_OP_TIMEOUT(t) (uintptr_t)(t).ticks
+#endif
+
+/**
+ * @brief Run several system calls with a single privilege transition
+ *
+ * The system calls are run in order, each one is verified exactly as if it
+ * was invoked on its own and its return value is stored in the ret field of
+ * its k_syscall_op. As for individual system calls, the calling thread is
+ * terminated if a verification fails.
+ *
+ * Only meant for user threads, supervisor threads call the kernel APIs
+ * directly.
+ *
+ * @param ops Array of system calls
+ * @param count Number of system calls in @a ops
+ *
+ * @retval 0 All system calls were run
+ * @retval -ENOTSUP Called from supervisor mode, nothing was run
+ */
+__syscall int k_syscall_batch(struct k_syscall_op *ops, size_t count);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#include <syscalls/syscall_batch.h>
+
+#endif /* ZEPHYR_INCLUDE_SYS_SYSCALL_BATCH_H_ */
@@ -1462,6 +1462,50 @@
  */
 #define sys_port_trace_k_msgq_get_exit(msgq, timeout, ret)
 
+/**
+ * @brief Trace Message Queue batched put attempt entry
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_put_many_enter(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batched put attempt blocking
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_put_many_blocking(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batched put attempt outcome
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_put_many_exit(msgq, timeout, ret)
+
+/**
+ * @brief Trace Message Queue batched get attempt entry
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_get_many_enter(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batched get attempt blocking
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ */
+#define sys_port_trace_k_msgq_get_many_blocking(msgq, timeout)
+
+/**
+ * @brief Trace Message Queue batched get attempt outcome
+ * @param msgq Message Queue object
+ * @param timeout Timeout period
+ * @param ret Return value
+ */
+#define sys_port_trace_k_msgq_get_many_exit(msgq, timeout, ret)
+
 /**
  * @brief Trace Message Queue peek
  * @param msgq Message Queue object
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <kernel_structs.h>
+#include <ksched.h>
+#include <sys/atomic.h>
+
+enum {
+	MUTEX_HITS,
+	MUTEX_MISSES,
+	SEM_HITS,
+	SEM_MISSES,
+	NUM_SPIN_STATS
+};
+
+static atomic_t spin_stats[NUM_SPIN_STATS];
+
+/* With a NULL thread, checks whether any other CPU is running a thread
+ * other than its idle thread, which is all that can be said of who may
+ * give a semaphore.
+ */
+static bool running_elsewhere(struct k_thread *thread)
+{
+	struct k_thread *current = _current;
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		struct k_thread *cpu_thread = _kernel.cpus[i].current;
+
+		if (cpu_thread == current) {
+			continue;
+		}
+
+		if ((thread != NULL) ? (cpu_thread == thread) :
+		    ((cpu_thread != NULL) &&
+		     !z_is_idle_thread_object(cpu_thread))) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool z_adaptive_spin_worthwhile(struct k_thread *owner)
+{
+	return running_elsewhere(owner);
+}
+
+bool z_adaptive_spin_continue(uint32_t start, struct k_thread *owner)
+{
+	if ((k_cycle_get_32() - start) >=
+	    k_us_to_cyc_ceil32(CONFIG_ADAPTIVE_SPIN_MAX_US)) {
+		return false;
+	}
+
+	return running_elsewhere(owner);
+}
+
+void z_adaptive_spin_mutex_stat(bool hit)
+{
+	(void)atomic_inc(&spin_stats[hit ? MUTEX_HITS : MUTEX_MISSES]);
+}
+
+void z_adaptive_spin_sem_stat(bool hit)
+{
+	(void)atomic_inc(&spin_stats[hit ? SEM_HITS : SEM_MISSES]);
+}
+
+void k_adaptive_spin_stats_get(struct k_adaptive_spin_stats *stats)
+{
+	stats->mutex_hits = (uint32_t)atomic_get(&spin_stats[MUTEX_HITS]);
+	stats->mutex_misses = (uint32_t)atomic_get(&spin_stats[MUTEX_MISSES]);
+	stats->sem_hits = (uint32_t)atomic_get(&spin_stats[SEM_HITS]);
+	stats->sem_misses = (uint32_t)atomic_get(&spin_stats[SEM_MISSES]);
+}
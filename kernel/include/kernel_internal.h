@@ -181,6 +181,13 @@ void z_mem_domain_exit_thread(struct k_thread *thread);
 extern struct k_spinlock z_mem_domain_lock;
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_USERSPACE
+/* Make @a owner the owner of @a mutex, for a sys_mutex taken without the
+ * k_mutex. Does nothing if the k_mutex already has an owner.
+ */
+void z_mutex_owner_adopt(struct k_mutex *mutex, struct k_thread *owner);
+#endif
+
 #ifdef CONFIG_GDBSTUB
 struct gdb_ctx;
 
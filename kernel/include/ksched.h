@@ -65,6 +65,24 @@ void z_requeue_current(struct k_thread *curr);
 struct k_thread *z_swap_next_thread(void);
 void z_thread_abort(struct k_thread *thread);
 
+#ifdef CONFIG_SCHED_DEADLINE_RESERVATION
+/* Budget accounting of deadline reservations, at context switches */
+void z_sched_reservation_switched_in(struct k_thread *thread);
+void z_sched_reservation_switched_out(struct k_thread *thread);
+#endif
+
+#ifdef CONFIG_ADAPTIVE_SPIN
+/* Adaptive spinning before pending on a mutex or semaphore: worthwhile
+ * if the owner (NULL for a semaphore, meaning any thread) is running on
+ * another CPU, and carried on while it still is and the spin time is
+ * not exhausted.
+ */
+bool z_adaptive_spin_worthwhile(struct k_thread *owner);
+bool z_adaptive_spin_continue(uint32_t start, struct k_thread *owner);
+void z_adaptive_spin_mutex_stat(bool hit);
+void z_adaptive_spin_sem_stat(bool hit);
+#endif
+
 static inline void z_pend_curr_unlocked(_wait_q_t *wait_q, k_timeout_t timeout)
 {
 	(void) z_pend_curr_irqlock(arch_irq_lock(), wait_q, timeout);
@@ -1145,6 +1145,30 @@ static inline void paging_stats_eviction_inc(struct k_thread *faulting_thread,
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 }
 
+static inline void paging_stats_batched_inc(struct k_thread *faulting_thread)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.eviction.batched++;
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.eviction.batched++;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
+static inline void paging_stats_read_ahead_inc(struct k_thread *faulting_thread)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.read_ahead.pages++;
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.read_ahead.pages++;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
 static inline struct z_page_frame *do_eviction_select(bool *dirty)
 {
 	struct z_page_frame *pf;
@@ -1179,6 +1203,110 @@ static inline struct z_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
+/*
+ * Evict up to CONFIG_DEMAND_PAGING_EVICTION_BATCH page frames to the free
+ * list, so that dirty pages are written back to the backing store in one
+ * go and subsequent page faults or read-ahead find free page frames.
+ *
+ * Called with interrupts locked by *key_ptr, and the scheduler locked if
+ * CONFIG_DEMAND_PAGING_ALLOW_IRQ. Stops early if the backing store is full,
+ * in which case the caller falls back to evicting a single page frame.
+ */
+static void evict_batch_locked(struct k_thread *faulting_thread, int *key_ptr)
+{
+	struct z_page_frame *pf;
+	uintptr_t location;
+	bool dirty;
+	int ret;
+
+	for (int i = 0; i < CONFIG_DEMAND_PAGING_EVICTION_BATCH; i++) {
+		dirty = false;
+		pf = do_eviction_select(&dirty);
+		if (pf == NULL) {
+			break;
+		}
+
+		ret = page_frame_prepare_locked(pf, &dirty, false, &location);
+		if (ret != 0) {
+			break;
+		}
+
+		LOG_DBG("batch evicting %p at 0x%lx", pf->addr,
+			z_page_frame_to_phys(pf));
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		irq_unlock(*key_ptr);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		if (dirty) {
+			do_backing_store_page_out(location);
+		}
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		*key_ptr = irq_lock();
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		page_frame_free_locked(pf);
+
+		paging_stats_eviction_inc(faulting_thread, dirty);
+		paging_stats_batched_inc(faulting_thread);
+	}
+}
+
+/*
+ * Page in up to CONFIG_DEMAND_PAGING_READ_AHEAD data pages following addr,
+ * stopping at the first one that is not paged out or when no free page
+ * frame is left. Pages are never evicted for read-ahead.
+ *
+ * Called with interrupts locked by *key_ptr, and the scheduler locked if
+ * CONFIG_DEMAND_PAGING_ALLOW_IRQ.
+ */
+static void read_ahead_locked(struct k_thread *faulting_thread, void *addr,
+			      int *key_ptr)
+{
+	uint8_t *pos = addr;
+	struct z_page_frame *pf;
+	uintptr_t location, unused;
+	enum arch_page_location status;
+	bool dirty;
+	int ret;
+
+	for (int i = 0; i < CONFIG_DEMAND_PAGING_READ_AHEAD; i++) {
+		pos += CONFIG_MMU_PAGE_SIZE;
+		if (pos >= Z_VIRT_RAM_END) {
+			break;
+		}
+
+		status = arch_page_location_get(pos, &location);
+		if (status != ARCH_PAGE_LOCATION_PAGED_OUT) {
+			break;
+		}
+
+		pf = free_page_frame_list_get();
+		if (pf == NULL) {
+			break;
+		}
+
+		/* Free page frame: only maps it to the scratch page */
+		dirty = false;
+		ret = page_frame_prepare_locked(pf, &dirty, true, &unused);
+		__ASSERT(ret == 0, "failed to prepare page frame");
+		(void)ret;
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		irq_unlock(*key_ptr);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		do_backing_store_page_in(location);
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+		*key_ptr = irq_lock();
+		pf->flags &= ~Z_PAGE_FRAME_BUSY;
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+		pf->flags |= Z_PAGE_FRAME_MAPPED;
+		pf->addr = pos;
+		arch_mem_page_in(pos, z_page_frame_to_phys(pf));
+		k_mem_paging_backing_store_page_finalize(pf, location);
+
+		paging_stats_read_ahead_inc(faulting_thread);
+	}
+}
+
 static bool do_page_fault(void *addr, bool pin)
 {
 	struct z_page_frame *pf;
@@ -1256,6 +1384,10 @@ static bool do_page_fault(void *addr, bool pin)
 		 "unexpected status value %d", status);
 
 	pf = free_page_frame_list_get();
+	if ((pf == NULL) && (CONFIG_DEMAND_PAGING_EVICTION_BATCH > 1)) {
+		evict_batch_locked(faulting_thread, &key);
+		pf = free_page_frame_list_get();
+	}
 	if (pf == NULL) {
 		/* Need to evict a page frame */
 		pf = do_eviction_select(&dirty);
@@ -1291,6 +1423,10 @@ static bool do_page_fault(void *addr, bool pin)
 	pf->addr = addr;
 	arch_mem_page_in(addr, z_page_frame_to_phys(pf));
 	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+
+	if (CONFIG_DEMAND_PAGING_READ_AHEAD > 0) {
+		read_ahead_locked(faulting_thread, addr, &key);
+	}
 out:
 	irq_unlock(key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
@@ -281,6 +281,227 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <syscalls/k_msgq_get_mrsh.c>
 #endif
 
+/* copy @a num_msgs messages into the ring buffer, in at most two runs */
+static void msgq_ring_write(struct k_msgq *msgq, const char *src,
+			    uint32_t num_msgs)
+{
+	msgq->used_msgs += num_msgs;
+
+	while (num_msgs > 0U) {
+		size_t run = MIN((size_t)num_msgs * msgq->msg_size,
+				 (size_t)(msgq->buffer_end - msgq->write_ptr));
+
+		(void)memcpy(msgq->write_ptr, src, run);
+		msgq->write_ptr += run;
+		if (msgq->write_ptr == msgq->buffer_end) {
+			msgq->write_ptr = msgq->buffer_start;
+		}
+		src += run;
+		num_msgs -= run / msgq->msg_size;
+	}
+}
+
+/* copy @a num_msgs messages out of the ring buffer, in at most two runs */
+static void msgq_ring_read(struct k_msgq *msgq, char *dst, uint32_t num_msgs)
+{
+	msgq->used_msgs -= num_msgs;
+
+	while (num_msgs > 0U) {
+		size_t run = MIN((size_t)num_msgs * msgq->msg_size,
+				 (size_t)(msgq->buffer_end - msgq->read_ptr));
+
+		(void)memcpy(dst, msgq->read_ptr, run);
+		msgq->read_ptr += run;
+		if (msgq->read_ptr == msgq->buffer_end) {
+			msgq->read_ptr = msgq->buffer_start;
+		}
+		dst += run;
+		num_msgs -= run / msgq->msg_size;
+	}
+}
+
+int z_impl_k_msgq_put_many(struct k_msgq *msgq, const void *data,
+			   uint32_t num_msgs, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	const char *src = data;
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t num_put = 0;
+	uint32_t num_buffered;
+	bool woken = false;
+	int result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put_many, msgq, timeout);
+
+	key = k_spin_lock(&msgq->lock);
+
+	/*
+	 * Receivers only wait on an empty queue, so while the queue is not
+	 * full the wait queue holds nothing but receivers. Hand each of them
+	 * a message, but defer rescheduling until the whole batch is done.
+	 */
+	while ((num_put < num_msgs) && (msgq->used_msgs < msgq->max_msgs)) {
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (pending_thread == NULL) {
+			break;
+		}
+
+		(void)memcpy(pending_thread->base.swap_data, src,
+			     msgq->msg_size);
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		src += msgq->msg_size;
+		num_put++;
+		woken = true;
+	}
+
+	num_buffered = MIN(num_msgs - num_put,
+			   msgq->max_msgs - msgq->used_msgs);
+	if (num_buffered > 0U) {
+		msgq_ring_write(msgq, src, num_buffered);
+		num_put += num_buffered;
+#ifdef CONFIG_POLL
+		handle_poll_events(msgq, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+	}
+
+	if (num_put > 0U || num_msgs == 0U) {
+		if (woken) {
+			z_reschedule(&msgq->lock, key);
+		} else {
+			k_spin_unlock(&msgq->lock, key);
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_many, msgq, timeout,
+					       num_put);
+
+		return num_put;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for message space to become available */
+		k_spin_unlock(&msgq->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_many, msgq, timeout,
+					       -ENOMSG);
+
+		return -ENOMSG;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put_many, msgq, timeout);
+
+	/* wait for the first message to be taken, as k_msgq_put() would */
+	_current->base.swap_data = (void *)src;
+
+	result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+	result = (result == 0) ? 1 : result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put_many, msgq, timeout, result);
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_many(struct k_msgq *msgq,
+					 const void *data, uint32_t num_msgs,
+					 k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_READ(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_put_many(msgq, data, num_msgs, timeout);
+}
+#include <syscalls/k_msgq_put_many_mrsh.c>
+#endif
+
+int z_impl_k_msgq_get_many(struct k_msgq *msgq, void *data,
+			   uint32_t num_msgs, k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t num_got;
+	bool woken = false;
+	int result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get_many, msgq, timeout);
+
+	key = k_spin_lock(&msgq->lock);
+
+	num_got = MIN(num_msgs, msgq->used_msgs);
+	if (num_got > 0U) {
+		msgq_ring_read(msgq, data, num_got);
+
+		/*
+		 * Senders only wait on a full queue, so the wait queue holds
+		 * nothing but senders. Let as many as fit into the freed
+		 * slots add their message, and ready them all at once.
+		 */
+		while (msgq->used_msgs < msgq->max_msgs) {
+			pending_thread = z_unpend_first_thread(&msgq->wait_q);
+			if (pending_thread == NULL) {
+				break;
+			}
+
+			msgq_ring_write(msgq, pending_thread->base.swap_data, 1);
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			woken = true;
+		}
+	}
+
+	if (num_got > 0U || num_msgs == 0U) {
+		if (woken) {
+			z_reschedule(&msgq->lock, key);
+		} else {
+			k_spin_unlock(&msgq->lock, key);
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_many, msgq, timeout,
+					       num_got);
+
+		return num_got;
+	}
+
+	if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		/* don't wait for a message to become available */
+		k_spin_unlock(&msgq->lock, key);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_many, msgq, timeout,
+					       -ENOMSG);
+
+		return -ENOMSG;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get_many, msgq, timeout);
+
+	/* wait for a single message, as k_msgq_get() would */
+	_current->base.swap_data = data;
+
+	result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+	result = (result == 0) ? 1 : result;
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get_many, msgq, timeout, result);
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_get_many(struct k_msgq *msgq, void *data,
+					 uint32_t num_msgs,
+					 k_timeout_t timeout)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(data, num_msgs, msgq->msg_size));
+
+	return z_impl_k_msgq_get_many(msgq, data, num_msgs, timeout);
+}
+#include <syscalls/k_msgq_get_many_mrsh.c>
+#endif
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
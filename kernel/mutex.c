@@ -30,6 +30,7 @@
 #include <kernel_structs.h>
 #include <toolchain.h>
 #include <ksched.h>
+#include <kernel_internal.h>
 #include <wait_q.h>
 #include <errno.h>
 #include <init.h>
@@ -92,11 +93,29 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+/* Poll a mutex, without holding the lock, while its owner keeps running
+ * on another CPU and for at most CONFIG_ADAPTIVE_SPIN_MAX_US.
+ */
+static void mutex_spin(struct k_mutex *mutex)
+{
+	volatile struct k_mutex *m = mutex;
+	uint32_t start = k_cycle_get_32();
+
+	while ((m->lock_count != 0U) &&
+	       z_adaptive_spin_continue(start, m->owner)) {
+	}
+}
+#endif
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
 	k_spinlock_key_t key;
 	bool resched = false;
+#ifdef CONFIG_ADAPTIVE_SPIN
+	bool spun = false;
+#endif
 
 	__ASSERT(!arch_is_in_isr(), "mutexes cannot be used inside ISRs");
 
@@ -104,7 +123,15 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+retry:
+#endif
 	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
+#ifdef CONFIG_ADAPTIVE_SPIN
+		if (spun) {
+			z_adaptive_spin_mutex_stat(true);
+		}
+#endif
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
 					_current->base.prio :
@@ -132,6 +159,24 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 		return -EBUSY;
 	}
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+	/* Waiters are handed the mutex directly on unlock, so spinning only
+	 * pays off while there are none.
+	 */
+	if (!spun && (z_waitq_head(&mutex->wait_q) == NULL) &&
+	    z_adaptive_spin_worthwhile(mutex->owner)) {
+		k_spin_unlock(&lock, key);
+		mutex_spin(mutex);
+		key = k_spin_lock(&lock);
+		spun = true;
+		goto retry;
+	}
+
+	if (spun) {
+		z_adaptive_spin_mutex_stat(false);
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_mutex, lock, mutex, timeout);
 
 	new_prio = new_prio_for_inheritance(_current->base.prio,
@@ -279,3 +324,18 @@ static inline int z_vrfy_k_mutex_unlock(struct k_mutex *mutex)
 }
 #include <syscalls/k_mutex_unlock_mrsh.c>
 #endif
+
+#ifdef CONFIG_USERSPACE
+void z_mutex_owner_adopt(struct k_mutex *mutex, struct k_thread *owner)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (mutex->owner == NULL) {
+		mutex->owner = owner;
+		mutex->lock_count = 1U;
+		mutex->owner_orig_prio = owner->base.prio;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+#endif /* CONFIG_USERSPACE */
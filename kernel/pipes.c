@@ -85,6 +85,30 @@ SYS_INIT(init_pipes_module, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_OBJECTS);
 
 #endif /* CONFIG_NUM_PIPE_ASYNC_MSGS */
 
+#ifdef CONFIG_POLL
+/* must be called with the pipe lock held */
+static inline void handle_poll_events(struct k_pipe *pipe)
+{
+	z_handle_obj_poll_events(&pipe->poll_events,
+				 K_POLL_STATE_PIPE_DATA_AVAILABLE);
+}
+#endif /* CONFIG_POLL */
+
+/**
+ * @brief Signal pollers that data has been added to the pipe's buffer
+ */
+static void pipe_data_added(struct k_pipe *pipe)
+{
+#ifdef CONFIG_POLL
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	handle_poll_events(pipe);
+	k_spin_unlock(&pipe->lock, key);
+#else
+	ARG_UNUSED(pipe);
+#endif
+}
+
 void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 {
 	pipe->buffer = buffer;
@@ -92,9 +116,14 @@ void k_pipe_init(struct k_pipe *pipe, unsigned char *buffer, size_t size)
 	pipe->bytes_used = 0;
 	pipe->read_index = 0;
 	pipe->write_index = 0;
+	pipe->put_claim = 0;
+	pipe->get_claim = 0;
 	pipe->lock = (struct k_spinlock){};
 	z_waitq_init(&pipe->wait_q.writers);
 	z_waitq_init(&pipe->wait_q.readers);
+#ifdef CONFIG_POLL
+	sys_dlist_init(&pipe->poll_events);
+#endif
 	SYS_PORT_TRACING_OBJ_INIT(k_pipe, pipe);
 
 	pipe->flags = 0;
@@ -491,9 +520,12 @@ int z_pipe_put_internal(struct k_pipe *pipe, struct k_pipe_async *async_desc,
 	 * readers. Add as much as possible to the pipe's circular buffer.
 	 */
 
-	num_bytes_written +=
-		pipe_buffer_put(pipe, data + num_bytes_written,
-				 bytes_to_write - num_bytes_written);
+	bytes_copied = pipe_buffer_put(pipe, data + num_bytes_written,
+				       bytes_to_write - num_bytes_written);
+	if (bytes_copied > 0) {
+		num_bytes_written += bytes_copied;
+		pipe_data_added(pipe);
+	}
 
 	if (num_bytes_written == bytes_to_write) {
 		*bytes_written = num_bytes_written;
@@ -552,6 +584,7 @@ int z_impl_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 	sys_dlist_t    xfer_list;
 	size_t         num_bytes_read = 0;
 	size_t         bytes_copied;
+	bool           data_added = false;
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, get, pipe, timeout);
 
@@ -648,6 +681,7 @@ int z_impl_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 
 		desc->buffer         += bytes_copied;
 		desc->bytes_to_xfer  -= bytes_copied;
+		data_added = data_added || (bytes_copied > 0);
 
 		/* Write request has been satisfied */
 		pipe_thread_ready(thread);
@@ -662,6 +696,12 @@ int z_impl_k_pipe_get(struct k_pipe *pipe, void *data, size_t bytes_to_read,
 
 		desc->buffer         += bytes_copied;
 		desc->bytes_to_xfer  -= bytes_copied;
+		data_added = data_added || (bytes_copied > 0);
+	}
+
+	/* Only pended writers can have refilled the buffer */
+	if (data_added) {
+		pipe_data_added(pipe);
 	}
 
 	if (num_bytes_read == bytes_to_read) {
@@ -752,6 +792,215 @@ int z_vrfy_k_pipe_put(struct k_pipe *pipe, void *data, size_t bytes_to_write,
 #include <syscalls/k_pipe_put_mrsh.c>
 #endif
 
+/*
+ * Serve the threads pended on a pipe when a claim is finished: readers from
+ * the data in the ring buffer unless a read claim holds it, then writers into
+ * the free space unless a write claim holds it, until neither moves data.
+ * Called with the pipe lock held, which is released.
+ */
+static void pipe_claim_xfer(struct k_pipe *pipe, k_spinlock_key_t key,
+			    bool data_added)
+{
+	struct k_thread    *thread;
+	struct k_thread    *waiter;
+	struct k_pipe_desc *desc;
+	sys_dlist_t    xfer_list;
+	size_t         bytes_copied;
+	bool           moved;
+
+	z_sched_lock();
+
+	do {
+		moved = false;
+
+		if ((pipe->get_claim == 0U) && (pipe->bytes_used > 0U)) {
+			(void)pipe_xfer_prepare(&xfer_list, &waiter,
+						&pipe->wait_q.readers, 0,
+						pipe->bytes_used, 0,
+						K_FOREVER);
+			k_spin_unlock(&pipe->lock, key);
+
+			thread = (struct k_thread *)sys_dlist_get(&xfer_list);
+			while (thread != NULL) {
+				desc = (struct k_pipe_desc *)
+				       thread->base.swap_data;
+				bytes_copied = pipe_buffer_get(pipe,
+							desc->buffer,
+							desc->bytes_to_xfer);
+
+				desc->buffer        += bytes_copied;
+				desc->bytes_to_xfer -= bytes_copied;
+				moved = true;
+
+				z_ready_thread(thread);
+
+				thread = (struct k_thread *)
+					 sys_dlist_get(&xfer_list);
+			}
+
+			if (waiter != NULL) {
+				desc = (struct k_pipe_desc *)
+				       waiter->base.swap_data;
+				bytes_copied = pipe_buffer_get(pipe,
+							desc->buffer,
+							desc->bytes_to_xfer);
+
+				desc->buffer        += bytes_copied;
+				desc->bytes_to_xfer -= bytes_copied;
+				moved = moved || (bytes_copied > 0U);
+			}
+
+			key = k_spin_lock(&pipe->lock);
+		}
+
+		if ((pipe->put_claim == 0U) && (pipe->bytes_used < pipe->size)) {
+			(void)pipe_xfer_prepare(&xfer_list, &waiter,
+						&pipe->wait_q.writers, 0,
+						pipe->size - pipe->bytes_used,
+						0, K_FOREVER);
+			k_spin_unlock(&pipe->lock, key);
+
+			thread = (struct k_thread *)sys_dlist_get(&xfer_list);
+			while (thread != NULL) {
+				desc = (struct k_pipe_desc *)
+				       thread->base.swap_data;
+				bytes_copied = pipe_buffer_put(pipe,
+							desc->buffer,
+							desc->bytes_to_xfer);
+
+				desc->buffer        += bytes_copied;
+				desc->bytes_to_xfer -= bytes_copied;
+				moved = true;
+				data_added = true;
+
+				pipe_thread_ready(thread);
+
+				thread = (struct k_thread *)
+					 sys_dlist_get(&xfer_list);
+			}
+
+			if (waiter != NULL) {
+				desc = (struct k_pipe_desc *)
+				       waiter->base.swap_data;
+				bytes_copied = pipe_buffer_put(pipe,
+							desc->buffer,
+							desc->bytes_to_xfer);
+
+				desc->buffer        += bytes_copied;
+				desc->bytes_to_xfer -= bytes_copied;
+				if (bytes_copied > 0U) {
+					moved = true;
+					data_added = true;
+				}
+			}
+
+			key = k_spin_lock(&pipe->lock);
+		}
+	} while (moved);
+
+	k_spin_unlock(&pipe->lock, key);
+
+	if (data_added && (pipe->bytes_used > 0U)) {
+		pipe_data_added(pipe);
+	}
+
+	k_sched_unlock();
+}
+
+size_t k_pipe_put_claim(struct k_pipe *pipe, uint8_t **data, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	size_t run_length = 0;
+
+	if (pipe->put_claim == 0U) {
+		run_length = MIN(pipe->size - pipe->bytes_used,
+				 pipe->size - pipe->write_index);
+		run_length = MIN(run_length, size);
+	}
+
+	if (run_length > 0) {
+		pipe->put_claim = run_length;
+		*data = pipe->buffer + pipe->write_index;
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return run_length;
+}
+
+int k_pipe_put_finish(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF((pipe->put_claim == 0U) || (size > pipe->put_claim)) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->put_claim = 0;
+	pipe->bytes_used += size;
+	pipe->write_index += size;
+	if (pipe->write_index == pipe->size) {
+		pipe->write_index = 0;
+	}
+
+	/*
+	 * Pended readers get the committed data, and writers held back by
+	 * the claim the space it did not use.
+	 */
+	pipe_claim_xfer(pipe, key, size > 0U);
+
+	return 0;
+}
+
+size_t k_pipe_get_claim(struct k_pipe *pipe, uint8_t **data, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	size_t run_length = 0;
+
+	if (pipe->get_claim == 0U) {
+		run_length = MIN(pipe->bytes_used,
+				 pipe->size - pipe->read_index);
+		run_length = MIN(run_length, size);
+	}
+
+	if (run_length > 0) {
+		pipe->get_claim = run_length;
+		*data = pipe->buffer + pipe->read_index;
+	}
+
+	k_spin_unlock(&pipe->lock, key);
+
+	return run_length;
+}
+
+int k_pipe_get_finish(struct k_pipe *pipe, size_t size)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+
+	CHECKIF((pipe->get_claim == 0U) || (size > pipe->get_claim)) {
+		k_spin_unlock(&pipe->lock, key);
+
+		return -EINVAL;
+	}
+
+	pipe->get_claim = 0;
+	pipe->bytes_used -= size;
+	pipe->read_index += size;
+	if (pipe->read_index == pipe->size) {
+		pipe->read_index = 0;
+	}
+
+	/*
+	 * Pended writers are moved into the space released, and readers held
+	 * back by the claim get the data it left in the pipe.
+	 */
+	pipe_claim_xfer(pipe, key, false);
+
+	return 0;
+}
+
 size_t z_impl_k_pipe_read_avail(struct k_pipe *pipe)
 {
 	size_t res;
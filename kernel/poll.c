@@ -34,10 +34,11 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
+static int signal_poll_set(struct k_poll_event *event, uint32_t state);
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 		       int mode, void *obj)
@@ -86,6 +87,12 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 			return true;
 		}
 		break;
+	case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
+		if (event->pipe->bytes_used > 0) {
+			*state = K_POLL_STATE_PIPE_DATA_AVAILABLE;
+			return true;
+		}
+		break;
 	case K_POLL_TYPE_IGNORE:
 		break;
 	default:
@@ -98,6 +105,10 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 
 static struct k_thread *poller_thread(struct z_poller *p)
 {
+	if ((p != NULL) && (p->mode == MODE_SET)) {
+		return CONTAINER_OF(p, struct k_poll_set, poller)->owner;
+	}
+
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
@@ -146,6 +157,10 @@ static inline void register_event(struct k_poll_event *event,
 		__ASSERT(event->msgq != NULL, "invalid message queue\n");
 		add_event(&event->msgq->poll_events, event, poller);
 		break;
+	case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
+		__ASSERT(event->pipe != NULL, "invalid pipe\n");
+		add_event(&event->pipe->poll_events, event, poller);
+		break;
 	case K_POLL_TYPE_IGNORE:
 		/* nothing to do */
 		break;
@@ -181,6 +196,10 @@ static inline void clear_event_registration(struct k_poll_event *event)
 		__ASSERT(event->msgq != NULL, "invalid message queue\n");
 		remove_event = true;
 		break;
+	case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
+		__ASSERT(event->pipe != NULL, "invalid pipe\n");
+		remove_event = true;
+		break;
 	case K_POLL_TYPE_IGNORE:
 		/* nothing to do */
 		break;
@@ -393,6 +412,9 @@ static inline int z_vrfy_k_poll(struct k_poll_event *events,
 		case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
 			Z_OOPS(Z_SYSCALL_OBJ(e->msgq, K_OBJ_MSGQ));
 			break;
+		case K_POLL_TYPE_PIPE_DATA_AVAILABLE:
+			Z_OOPS(Z_SYSCALL_OBJ(e->pipe, K_OBJ_PIPE));
+			break;
 		default:
 			ret = -EINVAL;
 			goto out_free;
@@ -423,6 +445,14 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 			retcode = signal_poller(event, state);
 		} else if (poller->mode == MODE_TRIGGERED) {
 			retcode = signal_triggered_work(event, state);
+		} else if (poller->mode == MODE_SET) {
+			/*
+			 * The set publishes the event with its state already
+			 * set, it must not be touched once it is on the ready
+			 * list.
+			 */
+			poller->is_polling = false;
+			return signal_poll_set(event, state);
 		} else {
 			;
 		}
@@ -538,6 +568,154 @@ static inline void z_vrfy_k_poll_signal_reset(struct k_poll_signal *sig)
 
 #endif
 
+/*
+ * Persistent poll sets. An event of a set is always on exactly one list:
+ * the poll_events list of its object while registered, the set's ready
+ * list once signalled, or the set's idle list after being returned to the
+ * owner. Objects unlink an event before signalling it, which lets the
+ * event node be reused for the set's own lists.
+ */
+
+/*
+ * Called with the lock of the signalling object held, not the poll lock,
+ * so the set's lists are protected by the set's own lock.
+ */
+static int signal_poll_set(struct k_poll_event *event, uint32_t state)
+{
+	struct k_poll_set *set =
+		CONTAINER_OF(event->poller, struct k_poll_set, poller);
+	k_spinlock_key_t key = k_spin_lock(&set->lock);
+	struct k_thread *thread;
+
+	set_event_ready(event, state);
+	sys_dlist_append(&set->ready, &event->_node);
+
+	thread = z_unpend_first_thread(&set->wait_q);
+	if (thread != NULL) {
+		arch_thread_return_value_set(thread, 0);
+		z_ready_thread(thread);
+	}
+
+	k_spin_unlock(&set->lock, key);
+
+	return 0;
+}
+
+void k_poll_set_init(struct k_poll_set *set, struct k_poll_event *events,
+		     int num_events)
+{
+	__ASSERT(events != NULL, "NULL events\n");
+	__ASSERT(num_events >= 0, "<0 events\n");
+
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	set->owner = _current;
+	set->events = events;
+	set->num_events = num_events;
+	sys_dlist_init(&set->ready);
+	sys_dlist_init(&set->idle);
+	set->lock = (struct k_spinlock){};
+	z_waitq_init(&set->wait_q);
+
+	for (int i = 0; i < num_events; i++) {
+		events[i].poller = NULL;
+		events[i].state = K_POLL_STATE_NOT_READY;
+		if (events[i].type != K_POLL_TYPE_IGNORE) {
+			sys_dlist_append(&set->idle, &events[i]._node);
+		}
+	}
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **ready,
+		    int max_ready, k_timeout_t timeout)
+{
+	struct k_poll_event *event;
+	k_spinlock_key_t key, set_key;
+	uint32_t state;
+	int num_ready = 0;
+	int rc = 0;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT(ready != NULL, "NULL ready\n");
+	__ASSERT(max_ready > 0, "no room for ready events\n");
+
+	set->owner = _current;
+
+	/*
+	 * Register the events returned by the previous wait again. As in
+	 * register_events(), release the locks between events to bound the
+	 * interrupt latency when many events need arming. The poll lock
+	 * covers the registration, the set lock the set's lists.
+	 */
+	for (;;) {
+		key = k_spin_lock(&lock);
+		set_key = k_spin_lock(&set->lock);
+
+		event = (struct k_poll_event *)sys_dlist_get(&set->idle);
+		if (event != NULL) {
+			event->state = K_POLL_STATE_NOT_READY;
+			if (is_condition_met(event, &state)) {
+				set_event_ready(event, state);
+				sys_dlist_append(&set->ready, &event->_node);
+			} else {
+				register_event(event, &set->poller);
+			}
+		}
+
+		k_spin_unlock(&set->lock, set_key);
+		k_spin_unlock(&lock, key);
+
+		if (event == NULL) {
+			break;
+		}
+	}
+
+	set_key = k_spin_lock(&set->lock);
+
+	if (sys_dlist_is_empty(&set->ready)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&set->lock, set_key);
+
+			return -EAGAIN;
+		}
+
+		rc = z_pend_curr(&set->lock, set_key, &set->wait_q, timeout);
+		set_key = k_spin_lock(&set->lock);
+	}
+
+	while ((num_ready < max_ready) &&
+	       ((event = (struct k_poll_event *)
+			 sys_dlist_get(&set->ready)) != NULL)) {
+		sys_dlist_append(&set->idle, &event->_node);
+		ready[num_ready++] = event;
+	}
+
+	k_spin_unlock(&set->lock, set_key);
+
+	return (num_ready > 0) ? num_ready : rc;
+}
+
+void k_poll_set_cleanup(struct k_poll_set *set)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	k_spinlock_key_t set_key = k_spin_lock(&set->lock);
+
+	for (int i = 0; i < set->num_events; i++) {
+		struct k_poll_event *event = &set->events[i];
+
+		event->poller = NULL;
+		if ((event->type != K_POLL_TYPE_IGNORE) &&
+		    sys_dnode_is_linked(&event->_node)) {
+			sys_dlist_remove(&event->_node);
+		}
+	}
+
+	sys_dlist_init(&set->ready);
+	sys_dlist_init(&set->idle);
+	k_spin_unlock(&set->lock, set_key);
+	k_spin_unlock(&lock, key);
+}
+
 static void triggered_work_handler(struct k_work *work)
 {
 	struct k_work_poll *twork =
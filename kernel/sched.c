@@ -178,12 +178,33 @@ static inline bool should_queue_thread(struct k_thread *th)
 	return !IS_ENABLED(CONFIG_SMP) || th != _current;
 }
 
+#ifdef CONFIG_SCHED_THREAD_STATS
+static struct k_sched_runq_stats runq_stats;
+#endif
+
+static ALWAYS_INLINE void runq_add(void *pq, struct k_thread *thread)
+{
+	_priq_run_add(pq, thread);
+#ifdef CONFIG_SCHED_THREAD_STATS
+	runq_stats.depth++;
+	runq_stats.max_depth = MAX(runq_stats.max_depth, runq_stats.depth);
+#endif
+}
+
+static ALWAYS_INLINE void runq_remove(void *pq, struct k_thread *thread)
+{
+	_priq_run_remove(pq, thread);
+#ifdef CONFIG_SCHED_THREAD_STATS
+	runq_stats.depth--;
+#endif
+}
+
 static ALWAYS_INLINE void queue_thread(void *pq,
 				       struct k_thread *thread)
 {
 	thread->base.thread_state |= _THREAD_QUEUED;
 	if (should_queue_thread(thread)) {
-		_priq_run_add(pq, thread);
+		runq_add(pq, thread);
 	}
 #ifdef CONFIG_SMP
 	if (thread == _current) {
@@ -198,7 +219,7 @@ static ALWAYS_INLINE void dequeue_thread(void *pq,
 {
 	thread->base.thread_state &= ~_THREAD_QUEUED;
 	if (should_queue_thread(thread)) {
-		_priq_run_remove(pq, thread);
+		runq_remove(pq, thread);
 	}
 }
 
@@ -212,7 +233,7 @@ static ALWAYS_INLINE void dequeue_thread(void *pq,
 void z_requeue_current(struct k_thread *curr)
 {
 	if (z_is_thread_queued(curr)) {
-		_priq_run_add(&_kernel.ready_q.runq, curr);
+		runq_add(&_kernel.ready_q.runq, curr);
 	}
 }
 #endif
@@ -476,6 +497,15 @@ static void ready_thread(struct k_thread *thread)
 	if (!z_is_thread_queued(thread) && z_is_thread_ready(thread)) {
 		SYS_PORT_TRACING_OBJ_FUNC(k_thread, sched_ready, thread);
 
+#ifdef CONFIG_SCHED_THREAD_STATS
+		/* Wakeup latency starts here, see z_thread_mark_switched_in() */
+		if (thread != _current) {
+			thread->rt_stats.ready_since = k_cycle_get_32();
+			thread->rt_stats.ready = true;
+			thread->rt_stats.woken = true;
+		}
+#endif
+
 		queue_thread(&_kernel.ready_q.runq, thread);
 		update_cache(0);
 #if defined(CONFIG_SMP) &&  defined(CONFIG_SCHED_IPI_SUPPORTED)
@@ -907,8 +937,7 @@ void *z_get_next_switch_handle(void *interrupted)
 			 * will not return into it.
 			 */
 			if (z_is_thread_queued(old_thread)) {
-				_priq_run_add(&_kernel.ready_q.runq,
-					      old_thread);
+				runq_add(&_kernel.ready_q.runq, old_thread);
 			}
 		}
 		old_thread->switch_handle = interrupted;
@@ -1107,6 +1136,38 @@ void z_sched_init(void)
 #endif
 }
 
+#ifdef CONFIG_SCHED_THREAD_STATS
+int k_sched_runq_stats_get(struct k_sched_runq_stats *stats)
+{
+	if (stats == NULL) {
+		return -EINVAL;
+	}
+
+	LOCKED(&sched_spinlock) {
+		*stats = runq_stats;
+	}
+
+	return 0;
+}
+
+int k_cpu_sched_stats_get(int cpu, struct k_cpu_sched_stats *stats)
+{
+	if ((stats == NULL) || (cpu < 0) || (cpu >= CONFIG_MP_NUM_CPUS)) {
+		return -EINVAL;
+	}
+
+	/* Updated at context switch with interrupts locked, the statistics
+	 * of another CPU may be slightly out of date.
+	 */
+	unsigned int key = arch_irq_lock();
+
+	*stats = _kernel.cpus[cpu].sched_stats;
+	arch_irq_unlock(key);
+
+	return 0;
+}
+#endif /* CONFIG_SCHED_THREAD_STATS */
+
 int z_impl_k_thread_priority_get(k_tid_t thread)
 {
 	return thread->base.prio;
@@ -1178,6 +1239,224 @@ static inline void z_vrfy_k_thread_deadline_set(k_tid_t tid, int deadline)
 }
 #include <syscalls/k_thread_deadline_set_mrsh.c>
 #endif
+
+#ifdef CONFIG_SCHED_DEADLINE_RESERVATION
+#define MAX_RESERVED_UTIL (CONFIG_SCHED_DEADLINE_MAX_UTILIZATION * 10000U)
+
+/* Sum of the utilizations of all reservations, in parts per million */
+static uint32_t reserved_util;
+
+static void budget_expired(struct _timeout *t);
+static int32_t z_tick_sleep(k_ticks_t ticks);
+
+static void arm_budget(struct _thread_reservation *r)
+{
+	z_add_timeout(&r->budget_timeout, budget_expired, K_CYC(r->budget));
+}
+
+/* Schedule the thread with a new deadline and a full budget */
+static void reservation_replenish(struct k_thread *thread, uint32_t deadline)
+{
+	struct _thread_reservation *r = &thread->reservation;
+
+	r->budget = r->runtime;
+	r->deadline = deadline;
+	thread->base.prio_deadline = deadline;
+	if (z_is_thread_queued(thread)) {
+		dequeue_thread(&_kernel.ready_q.runq, thread);
+		queue_thread(&_kernel.ready_q.runq, thread);
+	}
+}
+
+static void budget_expired(struct _timeout *t)
+{
+	struct k_thread *thread = CONTAINER_OF(t, struct k_thread,
+					       reservation.budget_timeout);
+	struct _thread_reservation *r = &thread->reservation;
+
+	LOCKED(&sched_spinlock) {
+		/* Unless it was switched out while this expired */
+		if ((r->period != 0U) && ((thread == _current) ||
+					  thread_active_elsewhere(thread))) {
+			/* Constant bandwidth server rule: the job goes on with
+			 * a new budget but a deadline one period later, and
+			 * only runs if it is still the earliest one.
+			 */
+			r->stats.overruns++;
+			reservation_replenish(thread, r->deadline + r->period);
+			r->switched_in = k_cycle_get_32();
+			arm_budget(r);
+			update_cache(0);
+		}
+	}
+}
+
+static void reservation_release(struct k_thread *thread)
+{
+	struct _thread_reservation *r = &thread->reservation;
+
+	(void)z_abort_timeout(&r->budget_timeout);
+	reserved_util -= r->util;
+	r->util = 0U;
+	r->runtime = 0U;
+	r->period = 0U;
+}
+
+/* Switched in from the arch code without sched_spinlock */
+void z_sched_reservation_switched_in(struct k_thread *thread)
+{
+	struct _thread_reservation *r = &thread->reservation;
+
+	LOCKED(&sched_spinlock) {
+		if (r->period != 0U) {
+			r->switched_in = k_cycle_get_32();
+			arm_budget(r);
+		}
+	}
+}
+
+/* Called with sched_spinlock held, or on a single CPU with interrupts
+ * locked
+ */
+void z_sched_reservation_switched_out(struct k_thread *thread)
+{
+	struct _thread_reservation *r = &thread->reservation;
+	uint32_t used;
+
+	if (r->period != 0U) {
+		(void)z_abort_timeout(&r->budget_timeout);
+		used = k_cycle_get_32() - r->switched_in;
+		r->budget -= MIN(used, r->budget);
+	}
+}
+
+int z_impl_k_thread_reservation_set(k_tid_t thread, uint32_t runtime_us,
+				    uint32_t period_us)
+{
+	struct _thread_reservation *r = &thread->reservation;
+	uint32_t util = 0U;
+	int ret = 0;
+
+	if (runtime_us != 0U) {
+		if ((runtime_us > period_us) ||
+		    (k_us_to_cyc_ceil64(period_us) > (uint64_t)INT32_MAX)) {
+			return -EINVAL;
+		}
+		/* Rounded up, so that a small runtime still reserves */
+		util = (uint32_t)ceiling_fraction((uint64_t)runtime_us *
+						  1000000U, period_us);
+	}
+
+	LOCKED(&sched_spinlock) {
+		if ((reserved_util - r->util + util) > MAX_RESERVED_UTIL) {
+			ret = -EBUSY;
+		} else if (util == 0U) {
+			reservation_release(thread);
+		} else {
+			(void)z_abort_timeout(&r->budget_timeout);
+			reserved_util = reserved_util - r->util + util;
+			r->util = util;
+			r->runtime = k_us_to_cyc_ceil32(runtime_us);
+			r->period = k_us_to_cyc_ceil32(period_us);
+			r->release = k_cycle_get_32();
+			reservation_replenish(thread, r->release + r->period);
+
+			if (thread == _current) {
+				r->switched_in = r->release;
+				arm_budget(r);
+			}
+		}
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_thread_reservation_set(k_tid_t thread,
+						  uint32_t runtime_us,
+						  uint32_t period_us)
+{
+	Z_OOPS(Z_SYSCALL_OBJ(thread, K_OBJ_THREAD));
+
+	return z_impl_k_thread_reservation_set(thread, runtime_us, period_us);
+}
+#include <syscalls/k_thread_reservation_set_mrsh.c>
+#endif
+
+int z_impl_k_thread_reservation_wait_next(void)
+{
+	struct _thread_reservation *r = &_current->reservation;
+	k_spinlock_key_t key = k_spin_lock(&sched_spinlock);
+	uint32_t now = k_cycle_get_32();
+	uint32_t release;
+	int ret = 0;
+
+	if (r->period == 0U) {
+		k_spin_unlock(&sched_spinlock, key);
+		return -EINVAL;
+	}
+
+	r->stats.jobs++;
+	release = r->release + r->period;
+	if ((int32_t)(now - release) > 0) {
+		/* Missed, the next job is released on the next period
+		 * boundary
+		 */
+		r->stats.misses++;
+		release += ((now - release) / r->period + 1U) * r->period;
+		ret = -ETIME;
+	}
+	r->release = release;
+	k_spin_unlock(&sched_spinlock, key);
+
+	(void)z_tick_sleep(k_cyc_to_ticks_ceil32(release - now));
+
+	LOCKED(&sched_spinlock) {
+		if (r->period != 0U) {
+			/* The budget timer was armed with what was left of
+			 * the previous budget when the thread was switched
+			 * back in.
+			 */
+			(void)z_abort_timeout(&r->budget_timeout);
+			reservation_replenish(_current,
+					      r->release + r->period);
+			r->switched_in = k_cycle_get_32();
+			arm_budget(r);
+		}
+	}
+
+	return ret;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_thread_reservation_wait_next(void)
+{
+	return z_impl_k_thread_reservation_wait_next();
+}
+#include <syscalls/k_thread_reservation_wait_next_mrsh.c>
+#endif
+
+void z_impl_k_thread_reservation_stats_get(k_tid_t thread,
+					   struct k_thread_reservation_stats *stats)
+{
+	LOCKED(&sched_spinlock) {
+		*stats = thread->reservation.stats;
+	}
+}
+
+#ifdef CONFIG_USERSPACE
+static inline void z_vrfy_k_thread_reservation_stats_get(k_tid_t thread,
+					struct k_thread_reservation_stats *stats)
+{
+	struct k_thread_reservation_stats stats_copy;
+
+	Z_OOPS(Z_SYSCALL_OBJ(thread, K_OBJ_THREAD));
+	z_impl_k_thread_reservation_stats_get(thread, &stats_copy);
+	Z_OOPS(z_user_to_copy(stats, &stats_copy, sizeof(stats_copy)));
+}
+#include <syscalls/k_thread_reservation_stats_get_mrsh.c>
+#endif
+#endif /* CONFIG_SCHED_DEADLINE_RESERVATION */
 #endif
 
 void z_impl_k_yield(void)
@@ -1475,6 +1754,11 @@ static void end_thread(struct k_thread *thread)
 			unpend_thread_no_timeout(thread);
 		}
 		(void)z_abort_thread_timeout(thread);
+#ifdef CONFIG_SCHED_DEADLINE_RESERVATION
+		if (thread->reservation.period != 0U) {
+			reservation_release(thread);
+		}
+#endif
 		unpend_all(&thread->join_queue);
 		update_cache(1);
 
@@ -114,9 +114,26 @@ static inline void z_vrfy_k_sem_give(struct k_sem *sem)
 #include <syscalls/k_sem_give_mrsh.c>
 #endif
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+/* Poll a semaphore, without holding the lock, while other CPUs are busy
+ * and for at most CONFIG_ADAPTIVE_SPIN_MAX_US.
+ */
+static void sem_spin(struct k_sem *sem)
+{
+	volatile struct k_sem *s = sem;
+	uint32_t start = k_cycle_get_32();
+
+	while ((s->count == 0U) && z_adaptive_spin_continue(start, NULL)) {
+	}
+}
+#endif
+
 int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 {
 	int ret = 0;
+#ifdef CONFIG_ADAPTIVE_SPIN
+	bool spun = false;
+#endif
 
 	__ASSERT(((arch_is_in_isr() == false) ||
 		  K_TIMEOUT_EQ(timeout, K_NO_WAIT)), "");
@@ -125,7 +142,15 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_sem, take, sem, timeout);
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+retry:
+#endif
 	if (likely(sem->count > 0U)) {
+#ifdef CONFIG_ADAPTIVE_SPIN
+		if (spun) {
+			z_adaptive_spin_sem_stat(true);
+		}
+#endif
 		sem->count--;
 		k_spin_unlock(&lock, key);
 		ret = 0;
@@ -138,6 +163,24 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 		goto out;
 	}
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+	/* A give wakes up waiters rather than incrementing the count, so
+	 * spinning only pays off while there are none.
+	 */
+	if (!spun && (z_waitq_head(&sem->wait_q) == NULL) &&
+	    z_adaptive_spin_worthwhile(NULL)) {
+		k_spin_unlock(&lock, key);
+		sem_spin(sem);
+		key = k_spin_lock(&lock);
+		spun = true;
+		goto retry;
+	}
+
+	if (spun) {
+		z_adaptive_spin_sem_stat(false);
+	}
+#endif
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
 	ret = z_pend_curr(&lock, key, &sem->wait_q, timeout);
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <string.h>
+#include <syscall_handler.h>
+#include <sys/speculation.h>
+#include <sys/syscall_batch.h>
+
+int z_impl_k_syscall_batch(struct k_syscall_op *ops, size_t count)
+{
+	ARG_UNUSED(ops);
+	ARG_UNUSED(count);
+
+	/* Only reached from supervisor mode, where there are no marshalling
+	 * functions to dispatch to.
+	 */
+	return -ENOTSUP;
+}
+
+static inline int z_vrfy_k_syscall_batch(struct k_syscall_op *ops,
+					 size_t count)
+{
+	void *ssf = _current->syscall_frame;
+	struct k_syscall_op op;
+	uint32_t id;
+
+	Z_OOPS(Z_SYSCALL_MEMORY_ARRAY_WRITE(ops, count, sizeof(*ops)));
+
+	for (size_t i = 0; i < count; i++) {
+		/* Work on a copy, another thread may modify the array */
+		(void)memcpy(&op, &ops[i], sizeof(op));
+
+		Z_OOPS(Z_SYSCALL_VERIFY_MSG((op.id < K_SYSCALL_LIMIT) &&
+					    (op.id != K_SYSCALL_K_SYSCALL_BATCH),
+					    "bad batched system call id %u",
+					    (unsigned int)op.id));
+		id = k_array_index_sanitize((uint32_t)op.id, K_SYSCALL_LIMIT);
+
+		/* The marshalling function does all the verification of an
+		 * individual system call and faults on ssf if it fails.
+		 */
+		ops[i].ret = _k_syscall_table[id](op.args[0], op.args[1],
+						  op.args[2], op.args[3],
+						  op.args[4], op.args[5], ssf);
+
+		/* Cleared by the marshalling function on return */
+		_current->syscall_frame = ssf;
+	}
+
+	return 0;
+}
+#include <syscalls/k_syscall_batch_mrsh.c>
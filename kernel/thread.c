@@ -587,6 +587,10 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 #ifdef CONFIG_SCHED_CPU_MASK
 	new_thread->base.cpu_mask = -1;
 #endif
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE
+	(void)memset(&new_thread->dyn_obj_cache, 0,
+		     sizeof(new_thread->dyn_obj_cache));
+#endif
 #ifdef CONFIG_ARCH_HAS_CUSTOM_SWAP_TO_MAIN
 	/* _current may be null if the dummy thread is not used */
 	if (!_current) {
@@ -612,6 +616,11 @@ char *z_setup_new_thread(struct k_thread *new_thread,
 	memset(&new_thread->rt_stats, 0, sizeof(new_thread->rt_stats));
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_RESERVATION
+	memset(&new_thread->reservation, 0, sizeof(new_thread->reservation));
+	z_init_timeout(&new_thread->reservation.budget_timeout);
+#endif
+
 	return stack_ptr;
 }
 
@@ -1005,16 +1014,84 @@ static inline k_ticks_t z_vrfy_k_thread_timeout_expires_ticks(
 #endif
 
 #ifdef CONFIG_INSTRUMENT_THREAD_SWITCHING
+#ifdef CONFIG_SCHED_THREAD_STATS
+static void sched_stats_switched_in(struct k_thread *thread)
+{
+	struct _thread_runtime_stats *rt = &thread->rt_stats;
+	uint32_t now, wait;
+	unsigned int bucket;
+	k_spinlock_key_t key;
+
+	/* Switched in from the arch code without sched_spinlock, which
+	 * k_thread_sched_stats_get() holds to read the 64-bit counters
+	 */
+	key = k_spin_lock(&sched_spinlock);
+
+	rt->sched_stats.switches++;
+	_current_cpu->sched_stats.switches++;
+
+	if (!rt->ready) {
+		k_spin_unlock(&sched_spinlock, key);
+		return;
+	}
+
+	now = k_cycle_get_32();
+	wait = now - rt->ready_since;
+	rt->sched_stats.ready_cycles += wait;
+
+	if (rt->woken) {
+		rt->sched_stats.max_wakeup_latency =
+			MAX(rt->sched_stats.max_wakeup_latency, wait);
+
+		bucket = MIN(find_msb_set(k_cyc_to_us_floor32(wait)),
+			     CONFIG_SCHED_THREAD_STATS_HIST_BUCKETS - 1);
+		rt->sched_stats.wakeup_hist[bucket]++;
+	}
+
+	rt->ready = false;
+	rt->woken = false;
+
+	k_spin_unlock(&sched_spinlock, key);
+}
+
+/* Called with sched_spinlock held, or on a single CPU with interrupts
+ * locked
+ */
+static void sched_stats_switched_out(struct k_thread *thread, uint64_t diff)
+{
+	if (z_is_idle_thread_object(thread)) {
+		_current_cpu->sched_stats.idle_cycles += diff;
+	} else {
+		_current_cpu->sched_stats.busy_cycles += diff;
+	}
+
+	/* Preempted, still ready to run */
+	if (z_is_thread_queued(thread)) {
+		thread->rt_stats.ready_since = k_cycle_get_32();
+		thread->rt_stats.ready = true;
+		thread->rt_stats.woken = false;
+	}
+}
+#endif /* CONFIG_SCHED_THREAD_STATS */
+
 void z_thread_mark_switched_in(void)
 {
 #ifdef CONFIG_TRACING
 	SYS_PORT_TRACING_FUNC(k_thread, switched_in);
 #endif
 
+#ifdef CONFIG_SCHED_DEADLINE_RESERVATION
+	z_sched_reservation_switched_in(k_current_get());
+#endif
+
 #ifdef CONFIG_THREAD_RUNTIME_STATS
 	struct k_thread *thread;
 
 	thread = k_current_get();
+
+#ifdef CONFIG_SCHED_THREAD_STATS
+	sched_stats_switched_in(thread);
+#endif
 #ifdef CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS
 	thread->rt_stats.last_switched_in = timing_counter_get();
 #else
@@ -1026,6 +1103,15 @@ void z_thread_mark_switched_in(void)
 
 void z_thread_mark_switched_out(void)
 {
+#ifdef CONFIG_SCHED_DEADLINE_RESERVATION
+	struct k_thread *current = k_current_get();
+
+	/* The dummy thread is not initialized */
+	if (current->base.thread_state != _THREAD_DUMMY) {
+		z_sched_reservation_switched_out(current);
+	}
+#endif
+
 #ifdef CONFIG_THREAD_RUNTIME_STATS
 #ifdef CONFIG_THREAD_RUNTIME_STATS_USE_TIMING_FUNCTIONS
 	timing_t now;
@@ -1060,6 +1146,10 @@ void z_thread_mark_switched_out(void)
 	thread->rt_stats.stats.execution_cycles += diff;
 
 	threads_runtime_stats.execution_cycles += diff;
+
+#ifdef CONFIG_SCHED_THREAD_STATS
+	sched_stats_switched_out(thread, diff);
+#endif
 #endif /* CONFIG_THREAD_RUNTIME_STATS */
 
 #ifdef CONFIG_TRACING
@@ -1092,6 +1182,25 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 
 	return 0;
 }
+
+#ifdef CONFIG_SCHED_THREAD_STATS
+int k_thread_sched_stats_get(k_tid_t thread,
+			     struct k_thread_sched_stats *stats)
+{
+	if ((thread == NULL) || (stats == NULL)) {
+		return -EINVAL;
+	}
+
+	/* The 64-bit counters may tear on 32-bit targets */
+	k_spinlock_key_t key = k_spin_lock(&sched_spinlock);
+
+	(void)memcpy(stats, &thread->rt_stats.sched_stats,
+		     sizeof(thread->rt_stats.sched_stats));
+	k_spin_unlock(&sched_spinlock, key);
+
+	return 0;
+}
+#endif /* CONFIG_SCHED_THREAD_STATS */
 #endif /* CONFIG_THREAD_RUNTIME_STATS */
 
 #endif /* CONFIG_INSTRUMENT_THREAD_SWITCHING */
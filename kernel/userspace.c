@@ -8,7 +8,6 @@
 #include <kernel.h>
 #include <string.h>
 #include <sys/math_extras.h>
-#include <sys/rb.h>
 #include <kernel_structs.h>
 #include <sys/sys_io.h>
 #include <ksched.h>
@@ -46,7 +45,7 @@ LOG_MODULE_DECLARE(os, CONFIG_KERNEL_LOG_LEVEL);
  * not.
  */
 #ifdef CONFIG_DYNAMIC_OBJECTS
-static struct k_spinlock lists_lock;       /* kobj rbtree/dlist */
+static struct k_spinlock lists_lock;       /* kobj hash/dlist */
 static struct k_spinlock objfree_lock;     /* k_object_free */
 #endif
 static struct k_spinlock obj_lock;         /* kobj struct data */
@@ -135,7 +134,7 @@ uint8_t *z_priv_stack_find(k_thread_stack_t *stack)
 struct dyn_obj {
 	struct z_object kobj;
 	sys_dnode_t dobj_list;
-	struct rbnode node; /* must be immediately before data member */
+	sys_dnode_t hash_node;
 
 	/* The object itself */
 	uint8_t data[] __aligned(DYN_OBJ_DATA_ALIGN_K_THREAD);
@@ -145,15 +144,17 @@ extern struct z_object *z_object_gperf_find(const void *obj);
 extern void z_object_gperf_wordlist_foreach(_wordlist_cb_func_t func,
 					     void *context);
 
-static bool node_lessthan(struct rbnode *a, struct rbnode *b);
+#define OBJ_HASH_SIZE	CONFIG_DYNAMIC_OBJECTS_HASH_SIZE
+
+BUILD_ASSERT((OBJ_HASH_SIZE & (OBJ_HASH_SIZE - 1)) == 0,
+	     "CONFIG_DYNAMIC_OBJECTS_HASH_SIZE must be a power of two");
 
 /*
- * Red/black tree of allocated kernel objects, for reasonably fast lookups
- * based on object pointer values.
+ * Hash table of allocated kernel objects, for constant time lookups based
+ * on object pointer values. Buckets are initialized on first use.
  */
-static struct rbtree obj_rb_tree = {
-	.lessthan_fn = node_lessthan
-};
+static sys_dlist_t obj_hash[OBJ_HASH_SIZE];
+static bool obj_hash_initialized;
 
 /*
  * Linked list of allocated kernel objects, for iteration over all allocated
@@ -162,9 +163,10 @@ static struct rbtree obj_rb_tree = {
 static sys_dlist_t obj_list = SYS_DLIST_STATIC_INIT(&obj_list);
 
 /*
- * TODO: Write some hash table code that will replace both obj_rb_tree
- * and obj_list.
+ * Incremented whenever an object is removed, which invalidates the
+ * per-thread lookup caches.
  */
+static atomic_t obj_generation;
 
 static size_t obj_size_get(enum k_objects otype)
 {
@@ -200,46 +202,100 @@ static size_t obj_align_get(enum k_objects otype)
 	return ret;
 }
 
-static bool node_lessthan(struct rbnode *a, struct rbnode *b)
+static sys_dlist_t *obj_hash_bucket(const void *obj)
 {
-	return a < b;
+	/* Objects are at least pointer aligned, drop the low bits and
+	 * spread the others over the buckets
+	 */
+	uint32_t hash = (uint32_t)((uintptr_t)obj / sizeof(void *)) *
+			2654435761U;
+
+	return &obj_hash[(hash ^ (hash >> 16)) & (OBJ_HASH_SIZE - 1)];
 }
 
-static inline struct dyn_obj *node_to_dyn_obj(struct rbnode *node)
+/* Must be called with lists_lock held */
+static void obj_hash_insert(struct dyn_obj *dyn)
 {
-	return CONTAINER_OF(node, struct dyn_obj, node);
+	if (!obj_hash_initialized) {
+		for (int i = 0; i < OBJ_HASH_SIZE; i++) {
+			sys_dlist_init(&obj_hash[i]);
+		}
+		obj_hash_initialized = true;
+	}
+
+	sys_dlist_append(obj_hash_bucket(&dyn->data), &dyn->hash_node);
 }
 
-static inline struct rbnode *dyn_obj_to_node(void *obj)
+static void obj_hash_remove(struct dyn_obj *dyn)
 {
-	struct dyn_obj *dobj = CONTAINER_OF(obj, struct dyn_obj, data);
-
-	return &dobj->node;
+	sys_dlist_remove(&dyn->hash_node);
+	(void)atomic_inc(&obj_generation);
 }
 
 static struct dyn_obj *dyn_object_find(void *obj)
 {
-	struct rbnode *node;
-	struct dyn_obj *ret;
-
-	/* For any dynamically allocated kernel object, the object
-	 * pointer is just a member of the conatining struct dyn_obj,
-	 * so just a little arithmetic is necessary to locate the
-	 * corresponding struct rbnode
-	 */
-	node = dyn_obj_to_node(obj);
+	sys_dlist_t *bucket = obj_hash_bucket(obj);
+	struct dyn_obj *dyn;
+	struct dyn_obj *ret = NULL;
 
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
-	if (rb_contains(&obj_rb_tree, node)) {
-		ret = node_to_dyn_obj(node);
-	} else {
-		ret = NULL;
+
+	if (obj_hash_initialized) {
+		SYS_DLIST_FOR_EACH_CONTAINER(bucket, dyn, hash_node) {
+			if ((void *)&dyn->data == obj) {
+				ret = dyn;
+				break;
+			}
+		}
 	}
 	k_spin_unlock(&lists_lock, key);
 
 	return ret;
 }
 
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE
+#define OBJ_CACHE_SIZE	CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE_SIZE
+
+BUILD_ASSERT((OBJ_CACHE_SIZE & (OBJ_CACHE_SIZE - 1)) == 0,
+	     "CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE_SIZE must be a power of two");
+
+/*
+ * Each thread caches the dynamic objects it last looked up, which needs no
+ * lock. Cached entries are only trusted while no object was removed since
+ * they were filled in, so they never point to freed memory. Only the
+ * thread itself touches its cache, ISRs do not use it.
+ */
+static struct dyn_obj *dyn_object_find_cached(void *obj)
+{
+	struct _dyn_obj_cache *cache = &_current->dyn_obj_cache;
+	uint32_t idx = ((uintptr_t)obj / sizeof(void *)) & (OBJ_CACHE_SIZE - 1);
+	/* Sampled before the lookup, a removal racing with it then
+	 * invalidates the entry filled in below
+	 */
+	uint32_t generation = (uint32_t)atomic_get(&obj_generation);
+	struct dyn_obj *dyn;
+
+	if (cache->generation == generation) {
+		if ((cache->entries[idx].obj == obj) &&
+		    (cache->entries[idx].ko != NULL)) {
+			return CONTAINER_OF(cache->entries[idx].ko,
+					    struct dyn_obj, kobj);
+		}
+	} else {
+		(void)memset(cache->entries, 0, sizeof(cache->entries));
+		cache->generation = generation;
+	}
+
+	dyn = dyn_object_find(obj);
+	if (dyn != NULL) {
+		cache->entries[idx].obj = obj;
+		cache->entries[idx].ko = &dyn->kobj;
+	}
+
+	return dyn;
+}
+#endif /* CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE */
+
 /**
  * @internal
  *
@@ -320,7 +376,7 @@ struct z_object *z_dynamic_object_aligned_create(size_t align, size_t size)
 
 	k_spinlock_key_t key = k_spin_lock(&lists_lock);
 
-	rb_insert(&obj_rb_tree, &dyn->node);
+	obj_hash_insert(dyn);
 	sys_dlist_append(&obj_list, &dyn->dobj_list);
 	k_spin_unlock(&lists_lock, key);
 
@@ -394,7 +450,7 @@ void k_object_free(void *obj)
 
 	dyn = dyn_object_find(obj);
 	if (dyn != NULL) {
-		rb_remove(&obj_rb_tree, &dyn->node);
+		obj_hash_remove(dyn);
 		sys_dlist_remove(&dyn->dobj_list);
 
 		if (dyn->kobj.type == K_OBJ_THREAD) {
@@ -421,7 +477,15 @@ struct z_object *z_object_find(const void *obj)
 		 * 11.8 but is justified since we know dynamic objects
 		 * were not declared with a const qualifier.
 		 */
+#ifdef CONFIG_DYNAMIC_OBJECTS_LOOKUP_CACHE
+		if (!k_is_in_isr() && (_current != NULL)) {
+			dynamic_obj = dyn_object_find_cached((void *)obj);
+		} else {
+			dynamic_obj = dyn_object_find((void *)obj);
+		}
+#else
 		dynamic_obj = dyn_object_find((void *)obj);
+#endif
 		if (dynamic_obj != NULL) {
 			ret = &dynamic_obj->kobj;
 		}
@@ -498,7 +562,7 @@ static void unref_check(struct z_object *ko, uintptr_t index)
 		break;
 	}
 
-	rb_remove(&obj_rb_tree, &dyn->node);
+	obj_hash_remove(dyn);
 	sys_dlist_remove(&dyn->dobj_list);
 	k_free(dyn);
 out:
@@ -71,10 +71,16 @@ static void handle_flush(struct k_work *work)
 	k_sem_give(&flusher->sem);
 }
 
-static inline void init_flusher(struct z_work_flusher *flusher)
+static inline void init_flusher(struct z_work_flusher *flusher,
+				struct k_work *work)
 {
 	k_sem_init(&flusher->sem, 0, 1);
 	k_work_init(&flusher->work, handle_flush);
+#ifdef CONFIG_WORKQUEUE_POOL
+	flusher->target = work;
+#else
+	ARG_UNUSED(work);
+#endif
 }
 
 /* List of pending cancellations. */
@@ -183,7 +189,7 @@ static void queue_flusher_locked(struct k_work_q *queue,
 		}
 	}
 
-	init_flusher(flusher);
+	init_flusher(flusher, work);
 	if (in_list) {
 		sys_slist_insert(&queue->pending, &work->node,
 				 &flusher->work.node);
@@ -207,6 +213,31 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 	}
 }
 
+/* Determine whether the current thread is one of the queue's threads.
+ *
+ * @param queue the queue to check
+ */
+static inline bool queue_is_current(const struct k_work_q *queue)
+{
+	if (k_is_in_isr()) {
+		return false;
+	}
+
+	if (_current == &queue->thread) {
+		return true;
+	}
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	for (size_t i = 0; i < queue->num_pool_threads; i++) {
+		if (_current == &queue->pool_threads[i]) {
+			return true;
+		}
+	}
+#endif
+
+	return false;
+}
+
 /* Potentially notify a queue that it needs to look for pending work.
  *
  * This may make the work queue thread ready, but as the lock is held it
@@ -256,7 +287,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret = -EBUSY;
-	bool chained = (_current == &queue->thread) && !k_is_in_isr();
+	bool chained = queue_is_current(queue);
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -573,6 +604,86 @@ bool k_work_cancel_sync(struct k_work *work,
 	return pending;
 }
 
+#ifdef CONFIG_WORKQUEUE_POOL
+
+/* Determine whether a pending work item may be started by a pool thread.
+ *
+ * An item that is still running on another pool thread must not be started,
+ * nor may a flusher for it, until that thread completes it.
+ *
+ * Invoked with work lock held.
+ */
+static inline bool work_runnable_locked(struct k_work *work)
+{
+	if (flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+		return false;
+	}
+
+	if (work->handler == handle_flush) {
+		struct z_work_flusher *flusher
+			= CONTAINER_OF(work, struct z_work_flusher, work);
+
+		return !flag_test(&flusher->target->flags, K_WORK_RUNNING_BIT);
+	}
+
+	return true;
+}
+
+/* Remove the first work item that may be started from the pending list.
+ *
+ * Invoked with work lock held.
+ *
+ * @return the removed node, or NULL if nothing can be started.
+ */
+static sys_snode_t *queue_get_locked(struct k_work_q *queue)
+{
+	sys_snode_t *prev = NULL;
+	sys_snode_t *node;
+
+	SYS_SLIST_FOR_EACH_NODE(&queue->pending, node) {
+		if (work_runnable_locked(CONTAINER_OF(node, struct k_work,
+						      node))) {
+			sys_slist_remove(&queue->pending, prev, node);
+			return node;
+		}
+		prev = node;
+	}
+
+	return NULL;
+}
+
+/* Account for a work item starting or completing on a queue thread.
+ *
+ * Invoked with work lock held.
+ */
+static inline void queue_busy_locked(struct k_work_q *queue, bool busy)
+{
+	if (busy) {
+		queue->num_busy++;
+		flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	} else if (--queue->num_busy == 0U) {
+		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	}
+}
+
+#else /* CONFIG_WORKQUEUE_POOL */
+
+static inline sys_snode_t *queue_get_locked(struct k_work_q *queue)
+{
+	return sys_slist_get(&queue->pending);
+}
+
+static inline void queue_busy_locked(struct k_work_q *queue, bool busy)
+{
+	if (busy) {
+		flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	} else {
+		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+	}
+}
+
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
@@ -588,18 +699,20 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		k_spinlock_key_t key = k_spin_lock(&lock);
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
+		node = queue_get_locked(queue);
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
-			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+			queue_busy_locked(queue, true);
 			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
-					       K_WORK_QUEUE_DRAIN_BIT)) {
+		} else if (!flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT)
+			   && sys_slist_is_empty(&queue->pending)
+			   && flag_test_and_clear(&queue->flags,
+						  K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
 			 * immediate reschedule; released threads get their
@@ -649,7 +762,17 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 				finalize_cancel_locked(work);
 			}
 
-			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+			queue_busy_locked(queue, false);
+#ifdef CONFIG_WORKQUEUE_POOL
+			/* Completing the item may have made items that other
+			 * pool threads skipped runnable: let an idle thread
+			 * look for them.
+			 */
+			if ((queue->num_pool_threads != 0U)
+			    && !sys_slist_is_empty(&queue->pending)) {
+				(void)notify_queue_locked(queue);
+			}
+#endif
 			yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 			k_spin_unlock(&lock, key);
 
@@ -663,19 +786,16 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 	}
 }
 
-void k_work_queue_start(struct k_work_q *queue,
-			k_thread_stack_t *stack,
-			size_t stack_size,
-			int prio,
-			const struct k_work_queue_config *cfg)
+/* Prepare the state of a work queue that is about to be started.
+ *
+ * @param queue the queue to be initialized
+ * @param cfg optional configuration
+ */
+static void work_queue_init(struct k_work_q *queue,
+			    const struct k_work_queue_config *cfg)
 {
-	__ASSERT_NO_MSG(queue);
-	__ASSERT_NO_MSG(stack);
-	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
 	uint32_t flags = K_WORK_QUEUE_STARTED;
 
-	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
-
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
@@ -689,19 +809,106 @@ void k_work_queue_start(struct k_work_q *queue,
 	 * to roll.
 	 */
 	flags_set(&queue->flags, flags);
+}
 
-	(void)k_thread_create(&queue->thread, stack, stack_size,
+/* Create one of the threads serving a work queue, without starting it.
+ *
+ * @param idx index of the thread within the queue's threads
+ */
+static void work_queue_thread_create(struct k_work_q *queue,
+				     struct k_thread *thread,
+				     k_thread_stack_t *stack,
+				     size_t stack_size, int prio,
+				     const struct k_work_queue_config *cfg,
+				     size_t idx)
+{
+	(void)k_thread_create(thread, stack, stack_size,
 			      work_queue_main, queue, NULL, NULL,
 			      prio, 0, K_FOREVER);
 
 	if ((cfg != NULL) && (cfg->name != NULL)) {
-		k_thread_name_set(&queue->thread, cfg->name);
+		k_thread_name_set(thread, cfg->name);
+	}
+
+#if defined(CONFIG_WORKQUEUE_POOL) && defined(CONFIG_SCHED_CPU_MASK)
+	if ((cfg != NULL) && cfg->pin_threads) {
+		(void)k_thread_cpu_mask_clear(thread);
+		(void)k_thread_cpu_mask_enable(thread,
+					       idx % CONFIG_MP_NUM_CPUS);
+	}
+#else
+	ARG_UNUSED(idx);
+#endif
+}
+
+void k_work_queue_start(struct k_work_q *queue,
+			k_thread_stack_t *stack,
+			size_t stack_size,
+			int prio,
+			const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(stack);
+	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+#ifdef CONFIG_WORKQUEUE_POOL
+	queue->pool_threads = NULL;
+	queue->num_pool_threads = 0U;
+	queue->num_busy = 0U;
+#endif
+
+	work_queue_init(queue, cfg);
+	work_queue_thread_create(queue, &queue->thread, stack, stack_size,
+				 prio, cfg, 0);
+	k_thread_start(&queue->thread);
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
+}
+
+#ifdef CONFIG_WORKQUEUE_POOL
+void k_work_queue_pool_start(struct k_work_q *queue,
+			     k_thread_stack_t *stacks, size_t stack_size,
+			     struct k_thread *threads, size_t num_threads,
+			     int prio, const struct k_work_queue_config *cfg)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(stacks);
+	__ASSERT_NO_MSG((num_threads >= 1U) && (num_threads <= UINT8_MAX));
+	__ASSERT_NO_MSG((threads != NULL) || (num_threads == 1U));
+	__ASSERT_NO_MSG(!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT));
+
+	size_t stride = K_THREAD_STACK_LEN(stack_size);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_work_queue, start, queue);
+
+	queue->pool_threads = threads;
+	queue->num_pool_threads = num_threads - 1U;
+	queue->num_busy = 0U;
+
+	work_queue_init(queue, cfg);
+
+	/* Create every thread before starting any, so that the set of
+	 * queue threads is complete once work can run.
+	 */
+	work_queue_thread_create(queue, &queue->thread, stacks, stack_size,
+				 prio, cfg, 0);
+	for (size_t i = 1; i < num_threads; i++) {
+		work_queue_thread_create(queue, &threads[i - 1],
+					 (k_thread_stack_t *)((uint8_t *)stacks
+							      + i * stride),
+					 stack_size, prio, cfg, i);
 	}
 
 	k_thread_start(&queue->thread);
+	for (size_t i = 1; i < num_threads; i++) {
+		k_thread_start(&threads[i - 1]);
+	}
 
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
+#endif /* CONFIG_WORKQUEUE_POOL */
 
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
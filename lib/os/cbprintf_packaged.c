@@ -185,11 +185,83 @@ static int cbprintf_via_va_list(cbprintf_cb out, void *ctx,
 
 #endif
 
+/**
+ * @brief Complete the package once all arguments are stored.
+ *
+ * Writes the package header and appends transient strings.
+ *
+ * @param buf0 Package start or null when only the length is calculated.
+ * @param buf Current position, just past the argument list.
+ * @param len Buffer capacity or accumulated string length in length mode.
+ * @param str_ptr_pos Locations (in words) of string pointers to append.
+ * @param s_idx Number of entries in @p str_ptr_pos.
+ *
+ * @return Package length or negative error code.
+ */
+static int package_finalize(char *buf0, char *buf, size_t len,
+			    const uint8_t *str_ptr_pos, unsigned int s_idx)
+{
+	unsigned int i, size;
+	const char *s;
+
+	/*
+	 * We remember the size of the argument list as a multiple of
+	 * sizeof(int) and limit it to a 8-bit field. That means 1020 bytes
+	 * worth of va_list, or about 127 arguments on a 64-bit system
+	 * (twice that on 32-bit systems). That ought to be good enough.
+	 */
+	if ((buf - buf0) / sizeof(int) > 255) {
+		__ASSERT(false, "too many format args");
+		return -EINVAL;
+	}
+
+	/*
+	 * If all we wanted was to count required buffer size
+	 * then we have it now.
+	 */
+	if (!buf0) {
+		return len + buf - buf0;
+	}
+
+	/* Clear our buffer header. We made room for it initially. */
+	*(char **)buf0 = NULL;
+
+	/* Record end of argument list and number of appended strings. */
+	buf0[0] = (buf - buf0) / sizeof(int);
+	buf0[1] = s_idx;
+
+	/* Store strings prefixed by their pointer location. */
+	for (i = 0; i < s_idx; i++) {
+		/* retrieve the string pointer */
+		s = *(char **)(buf0 + str_ptr_pos[i] * sizeof(int));
+		/* clear the in-buffer pointer (less entropy if compressed) */
+		*(char **)(buf0 + str_ptr_pos[i] * sizeof(int)) = NULL;
+		/* find the string length including terminating '\0' */
+		size = strlen(s) + 1;
+		/* make sure it fits */
+		if (buf - buf0 + 1 + size > len) {
+			return -ENOSPC;
+		}
+		/* store the pointer position prefix */
+		*buf++ = str_ptr_pos[i];
+		/* copy the string with its terminating '\0' */
+		memcpy(buf, s, size);
+		buf += size;
+	}
+
+	/*
+	 * TODO: remove pointers for appended strings since they're useless.
+	 * TODO: explore leveraging same mechanism to remove alignment padding
+	 */
+
+	return buf - buf0;
+}
+
 int cbvprintf_package(void *packaged, size_t len,
 		      const char *fmt, va_list ap)
 {
 	char *buf = packaged, *buf0 = buf;
-	unsigned int align, size, i, s_idx = 0;
+	unsigned int align, size, s_idx = 0;
 	uint8_t str_ptr_pos[16];
 	const char *s;
 	bool parsing = false;
@@ -447,66 +519,185 @@ process_string:
 		}
 	}
 
-	/*
-	 * We remember the size of the argument list as a multiple of
-	 * sizeof(int) and limit it to a 8-bit field. That means 1020 bytes
-	 * worth of va_list, or about 127 arguments on a 64-bit system
-	 * (twice that on 32-bit systems). That ought to be good enough.
-	 */
-	if ((buf - buf0) / sizeof(int) > 255) {
-		__ASSERT(false, "too many format args");
+	return package_finalize(buf0, buf, len, str_ptr_pos, s_idx);
+}
+
+int cbprintf_package(void *packaged, size_t len, const char *format, ...)
+{
+	va_list ap;
+	int ret;
+
+	va_start(ap, format);
+	ret = cbvprintf_package(packaged, len, format, ap);
+	va_end(ap);
+	return ret;
+}
+
+int cbvprintf_package_desc(void *packaged, size_t len,
+			   const uint8_t *desc, size_t desc_len,
+			   const char *fmt, va_list ap)
+{
+	static const uint8_t arg_align[] = {
+		[Z_CBPRINTF_ARG_INT] = VA_STACK_ALIGN(int),
+		[Z_CBPRINTF_ARG_LONG] = VA_STACK_ALIGN(long),
+		[Z_CBPRINTF_ARG_LONG_LONG] = VA_STACK_ALIGN(long long),
+		[Z_CBPRINTF_ARG_DOUBLE] = VA_STACK_ALIGN(double),
+		[Z_CBPRINTF_ARG_LONG_DOUBLE] = VA_STACK_ALIGN(long double),
+		[Z_CBPRINTF_ARG_PTR] = VA_STACK_ALIGN(void *),
+		[Z_CBPRINTF_ARG_STR] = VA_STACK_ALIGN(char *),
+	};
+	static const uint8_t arg_size[] = {
+		[Z_CBPRINTF_ARG_INT] = sizeof(int),
+		[Z_CBPRINTF_ARG_LONG] = sizeof(long),
+		[Z_CBPRINTF_ARG_LONG_LONG] = sizeof(long long),
+		[Z_CBPRINTF_ARG_DOUBLE] = sizeof(double),
+		[Z_CBPRINTF_ARG_LONG_DOUBLE] = sizeof(long double),
+		[Z_CBPRINTF_ARG_PTR] = sizeof(void *),
+		[Z_CBPRINTF_ARG_STR] = sizeof(char *),
+	};
+	char *buf = packaged, *buf0 = buf;
+	unsigned int size, s_idx = 0;
+	uint8_t str_ptr_pos[16];
+	const char *s;
+
+	/* First entry describes the format string itself. */
+	if (desc_len == 0 || desc[0] != Z_CBPRINTF_ARG_STR) {
 		return -EINVAL;
 	}
 
-	/*
-	 * If all we wanted was to count required buffer size
-	 * then we have it now.
-	 */
+	if ((uintptr_t)packaged & (sizeof(void *) - 1)) {
+		return -EFAULT;
+	}
+
+#if defined(__xtensa__)
+	if ((uintptr_t)packaged & (CBPRINTF_PACKAGE_ALIGNMENT - 1)) {
+		return -EFAULT;
+	}
+#endif
+
+	/* Reserve header, see cbvprintf_package(). */
+	buf += sizeof(char *);
+
 	if (!buf0) {
-		return len + buf - buf0;
+#if defined(__xtensa__)
+		if (len % CBPRINTF_PACKAGE_ALIGNMENT) {
+			return -EFAULT;
+		}
+#endif
+		buf += len % CBPRINTF_PACKAGE_ALIGNMENT;
+		len = -(len % CBPRINTF_PACKAGE_ALIGNMENT);
 	}
 
-	/* Clear our buffer header. We made room for it initially. */
-	*(char **)buf0 = NULL;
+	for (size_t i = 0; i < desc_len; i++) {
+		uint8_t type = desc[i];
 
-	/* Record end of argument list and number of appended strings. */
-	buf0[0] = (buf - buf0) / sizeof(int);
-	buf0[1] = s_idx;
+		if (type >= ARRAY_SIZE(arg_size)) {
+			__ASSERT(false, "invalid descriptor entry %u", type);
+			return -EINVAL;
+		}
 
-	/* Store strings prefixed by their pointer location. */
-	for (i = 0; i < s_idx; i++) {
-		/* retrieve the string pointer */
-		s = *(char **)(buf0 + str_ptr_pos[i] * sizeof(int));
-		/* clear the in-buffer pointer (less entropy if compressed) */
-		*(char **)(buf0 + str_ptr_pos[i] * sizeof(int)) = NULL;
-		/* find the string length including terminating '\0' */
-		size = strlen(s) + 1;
-		/* make sure it fits */
-		if (buf - buf0 + 1 + size > len) {
+		size = arg_size[type];
+		buf = (void *) ROUND_UP(buf, arg_align[type]);
+
+		if (buf0 && buf - buf0 + size > len) {
 			return -ENOSPC;
 		}
-		/* store the pointer position prefix */
-		*buf++ = str_ptr_pos[i];
-		/* copy the string with its terminating '\0' */
-		memcpy(buf, s, size);
+
+		switch (type) {
+		case Z_CBPRINTF_ARG_STR:
+			s = (i == 0) ? fmt : va_arg(ap, const char *);
+			if (buf0) {
+				*(const char **)buf = s;
+			}
+			if (ptr_in_rodata(s)) {
+				/* do nothing special */
+			} else if (buf0) {
+				if (s_idx >= ARRAY_SIZE(str_ptr_pos)) {
+					__ASSERT(false, "str_ptr_pos[] too small");
+					return -EINVAL;
+				}
+				str_ptr_pos[s_idx++] = (buf - buf0) / sizeof(int);
+			} else {
+				len += strlen(s) + 1 + 1;
+			}
+			break;
+		case Z_CBPRINTF_ARG_PTR: {
+			void *v = va_arg(ap, void *);
+
+			if (buf0) {
+				*(void **)buf = v;
+			}
+			break;
+		}
+		case Z_CBPRINTF_ARG_DOUBLE: {
+			double v = va_arg(ap, double);
+
+			if (buf0) {
+				if (Z_CBPRINTF_VA_STACK_LL_DBL_MEMCPY) {
+					memcpy(buf, &v, size);
+				} else {
+					*(double *)buf = v;
+				}
+			}
+			break;
+		}
+		case Z_CBPRINTF_ARG_LONG_DOUBLE: {
+			long double v = va_arg(ap, long double);
+
+			if (buf0) {
+				if (Z_CBPRINTF_VA_STACK_LL_DBL_MEMCPY) {
+					memcpy(buf, &v, size);
+				} else {
+					*(long double *)buf = v;
+				}
+			}
+			break;
+		}
+		case Z_CBPRINTF_ARG_LONG_LONG: {
+			long long v = va_arg(ap, long long);
+
+			if (buf0) {
+				if (Z_CBPRINTF_VA_STACK_LL_DBL_MEMCPY) {
+					memcpy(buf, &v, size);
+				} else {
+					*(long long *)buf = v;
+				}
+			}
+			break;
+		}
+		case Z_CBPRINTF_ARG_LONG: {
+			long v = va_arg(ap, long);
+
+			if (buf0) {
+				*(long *)buf = v;
+			}
+			break;
+		}
+		default: {
+			int v = va_arg(ap, int);
+
+			if (buf0) {
+				*(int *)buf = v;
+			}
+			break;
+		}
+		}
+
 		buf += size;
 	}
 
-	/*
-	 * TODO: remove pointers for appended strings since they're useless.
-	 * TODO: explore leveraging same mechanism to remove alignment padding
-	 */
-
-	return buf - buf0;
+	return package_finalize(buf0, buf, len, str_ptr_pos, s_idx);
 }
 
-int cbprintf_package(void *packaged, size_t len, const char *format, ...)
+int cbprintf_package_desc(void *packaged, size_t len,
+			  const uint8_t *desc, size_t desc_len,
+			  const char *format, ...)
 {
 	va_list ap;
 	int ret;
 
 	va_start(ap, format);
-	ret = cbvprintf_package(packaged, len, format, ap);
+	ret = cbvprintf_package_desc(packaged, len, desc, desc_len, format, ap);
 	va_end(ap);
 	return ret;
 }
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_LIB_OS_CRC_INTERNAL_H_
+#define ZEPHYR_LIB_OS_CRC_INTERNAL_H_
+
+#include <zephyr/types.h>
+#include <stddef.h>
+#include <sys/byteorder.h>
+
+#if defined(CONFIG_CRC_HW_ACCEL) && defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+/*
+ * Update a reflected CRC32 using slicing-by-8 tables.
+ *
+ * @p table[0] is the regular byte-wise table, @p table[k] holds the
+ * contribution of a byte followed by k zero bytes. Eight input bytes are
+ * consumed per iteration. The CRC is neither pre nor post inverted here.
+ */
+static inline uint32_t crc32_sb8_update(const uint32_t table[8][256],
+					uint32_t crc, const uint8_t *data,
+					size_t len)
+{
+	while (len >= 8) {
+		uint32_t lo = crc ^ sys_get_le32(data);
+		uint32_t hi = sys_get_le32(data + 4);
+
+		crc = table[7][lo & 0xff] ^
+		      table[6][(lo >> 8) & 0xff] ^
+		      table[5][(lo >> 16) & 0xff] ^
+		      table[4][lo >> 24] ^
+		      table[3][hi & 0xff] ^
+		      table[2][(hi >> 8) & 0xff] ^
+		      table[1][(hi >> 16) & 0xff] ^
+		      table[0][hi >> 24];
+
+		data += 8;
+		len -= 8;
+	}
+
+	while (len-- > 0) {
+		crc = (crc >> 8) ^ table[0][(crc ^ *data++) & 0xff];
+	}
+
+	return crc;
+}
+
+/*
+ * CPU CRC instructions. CRC32C_ARCH_UPDATE and CRC32_IEEE_ARCH_UPDATE are
+ * only defined when the instruction set of the target provides the
+ * corresponding polynomial; algorithms without one fall back to tables.
+ */
+#if defined(CONFIG_CRC_HW_ACCEL) && defined(CONFIG_X86)
+
+/* SSE4.2 crc32 instruction, Castagnoli polynomial only */
+static inline uint32_t crc32c_arch_update(uint32_t crc, const uint8_t *data,
+					  size_t len)
+{
+#if defined(CONFIG_64BIT)
+	uint64_t crc64 = crc;
+
+	while (len >= 8) {
+		__asm__ ("crc32q %1, %0" : "+r"(crc64) : "rm"(sys_get_le64(data)));
+		data += 8;
+		len -= 8;
+	}
+
+	crc = (uint32_t)crc64;
+#endif
+
+	while (len >= 4) {
+		__asm__ ("crc32l %1, %0" : "+r"(crc) : "rm"(sys_get_le32(data)));
+		data += 4;
+		len -= 4;
+	}
+
+	while (len-- > 0) {
+		__asm__ ("crc32b %1, %0" : "+r"(crc) : "rm"(*data++));
+	}
+
+	return crc;
+}
+
+#define CRC32C_ARCH_UPDATE crc32c_arch_update
+
+#elif defined(CONFIG_CRC_HW_ACCEL) && defined(__ARM_FEATURE_CRC32)
+
+/* ARMv8 CRC32 extension, both polynomials */
+static inline uint32_t crc32c_arch_update(uint32_t crc, const uint8_t *data,
+					  size_t len)
+{
+	while (len >= 8) {
+		crc = __crc32cd(crc, sys_get_le64(data));
+		data += 8;
+		len -= 8;
+	}
+
+	while (len-- > 0) {
+		crc = __crc32cb(crc, *data++);
+	}
+
+	return crc;
+}
+
+static inline uint32_t crc32_ieee_arch_update(uint32_t crc,
+					      const uint8_t *data, size_t len)
+{
+	while (len >= 8) {
+		crc = __crc32d(crc, sys_get_le64(data));
+		data += 8;
+		len -= 8;
+	}
+
+	while (len-- > 0) {
+		crc = __crc32b(crc, *data++);
+	}
+
+	return crc;
+}
+
+#define CRC32C_ARCH_UPDATE crc32c_arch_update
+#define CRC32_IEEE_ARCH_UPDATE crc32_ieee_arch_update
+
+#endif /* CONFIG_CRC_HW_ACCEL */
+
+#endif /* ZEPHYR_LIB_OS_CRC_INTERNAL_H_ */
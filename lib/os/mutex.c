@@ -8,8 +8,10 @@
 #include <sys/mutex.h>
 #include <syscall_handler.h>
 #include <kernel_structs.h>
+#include <ksched.h>
+#include <kernel_internal.h>
 
-static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
+static struct z_sys_mutex_data *get_sys_mutex_data(struct sys_mutex *mutex)
 {
 	struct z_object *obj;
 
@@ -18,27 +20,115 @@ static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 		return NULL;
 	}
 
-	return obj->data.mutex;
+	return obj->data.sys_mutex_data;
 }
 
 static bool check_sys_mutex_addr(struct sys_mutex *addr)
 {
-	/* sys_mutex memory is never touched, just used to lookup the
-	 * underlying k_mutex, but we don't want threads using mutexes
-	 * that are outside their memory domain
+	/* sys_mutex memory is read and updated by the kernel when the mutex
+	 * is contended, and we don't want threads using mutexes that are
+	 * outside their memory domain
 	 */
 	return Z_SYSCALL_MEMORY_WRITE(addr, sizeof(struct sys_mutex));
 }
 
+/*
+ * The owner ID in sys_mutex memory is untrusted. It must name a live thread
+ * object the caller has been granted access to before the kernel records it
+ * as the owner of the backing k_mutex.
+ */
+static bool is_valid_owner(atomic_val_t owner_id)
+{
+	struct z_object *obj = z_object_find((void *)owner_id);
+
+	if (z_object_validate(obj, K_OBJ_THREAD, _OBJ_INIT_TRUE) != 0) {
+		return false;
+	}
+
+	return !z_is_thread_state_set((struct k_thread *)owner_id,
+				      _THREAD_DEAD);
+}
+
+/*
+ * Kernel side of the sys_mutex protocol. The uncontended cases mirror the
+ * user space fast path in sys/mutex.h, which is skipped entirely when
+ * CONFIG_SYS_MUTEX_FAST_PATH is disabled.
+ *
+ * Once a thread has to wait, the mutex is flagged Z_SYS_MUTEX_CONTENDED so
+ * that its owner has to release it through the kernel, and the owner is
+ * made the owner of the backing k_mutex if it took the mutex on the fast
+ * path. Waiting on the k_mutex then applies priority inheritance as usual.
+ */
 int z_impl_z_sys_mutex_kernel_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
-	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
+	struct z_sys_mutex_data *data = get_sys_mutex_data(mutex);
+	atomic_val_t self = (atomic_val_t)_current;
+	atomic_val_t owner_id;
+	atomic_val_t val;
+	k_spinlock_key_t key;
+	int ret;
 
-	if (kernel_mutex == NULL) {
+	if (data == NULL) {
 		return -EINVAL;
 	}
 
-	return k_mutex_lock(kernel_mutex, timeout);
+	key = k_spin_lock(&data->lock);
+
+	for (;;) {
+		val = atomic_get(&mutex->val);
+		if (val == 0) {
+			if (atomic_cas(&mutex->val, 0, self)) {
+				mutex->lock_count = 1U;
+				k_spin_unlock(&data->lock, key);
+				return 0;
+			}
+			continue;
+		}
+
+		owner_id = val & ~Z_SYS_MUTEX_CONTENDED;
+		if (owner_id == self) {
+			mutex->lock_count++;
+			k_spin_unlock(&data->lock, key);
+			return 0;
+		}
+
+		if (owner_id != 0 && data->mutex.owner == NULL &&
+		    !is_valid_owner(owner_id)) {
+			k_spin_unlock(&data->lock, key);
+			return -EINVAL;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT) && owner_id != 0) {
+			k_spin_unlock(&data->lock, key);
+			return -EBUSY;
+		}
+
+		if (atomic_cas(&mutex->val, val, val | Z_SYS_MUTEX_CONTENDED)) {
+			break;
+		}
+	}
+
+	if (owner_id != 0) {
+		/* The owner fields are updated under the k_mutex lock */
+		z_mutex_owner_adopt(&data->mutex,
+				    (struct k_thread *)owner_id);
+	}
+
+	data->num_waiters++;
+	k_spin_unlock(&data->lock, key);
+
+	ret = k_mutex_lock(&data->mutex, timeout);
+
+	key = k_spin_lock(&data->lock);
+	data->num_waiters--;
+	if (ret == 0) {
+		/* Stay flagged so the release also goes through the kernel */
+		atomic_set(&mutex->val, self | Z_SYS_MUTEX_CONTENDED);
+		mutex->lock_count = 1U;
+	}
+	k_spin_unlock(&data->lock, key);
+
+	return ret;
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
@@ -52,15 +142,60 @@ static inline int z_vrfy_z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
 }
 #include <syscalls/z_sys_mutex_kernel_lock_mrsh.c>
 
+/*
+ * When contended, the backing k_mutex is handed to the next waiter, if
+ * any, and the user visible state is updated before any thread can run:
+ * the fast path stays disabled while threads are still inside the
+ * contended lock path.
+ */
 int z_impl_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
 {
-	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
+	struct z_sys_mutex_data *data = get_sys_mutex_data(mutex);
+	atomic_val_t self = (atomic_val_t)_current;
+	atomic_val_t owner_id;
+	k_spinlock_key_t key;
+	int ret;
 
-	if (kernel_mutex == NULL || kernel_mutex->lock_count == 0) {
+	if (data == NULL) {
 		return -EINVAL;
 	}
 
-	return k_mutex_unlock(kernel_mutex);
+	owner_id = atomic_get(&mutex->val) & ~Z_SYS_MUTEX_CONTENDED;
+	if (owner_id == 0) {
+		return -EINVAL;
+	}
+
+	if (owner_id != self) {
+		return -EPERM;
+	}
+
+	if (mutex->lock_count > 1U) {
+		mutex->lock_count--;
+		return 0;
+	}
+
+	mutex->lock_count = 0U;
+	if (atomic_cas(&mutex->val, self, 0)) {
+		return 0;
+	}
+
+	key = k_spin_lock(&data->lock);
+
+	ret = k_mutex_unlock(&data->mutex);
+	if (ret == 0) {
+		if (data->mutex.owner != NULL) {
+			atomic_set(&mutex->val, (atomic_val_t)data->mutex.owner |
+						Z_SYS_MUTEX_CONTENDED);
+		} else if (data->num_waiters > 0U) {
+			atomic_set(&mutex->val, Z_SYS_MUTEX_CONTENDED);
+		} else {
+			atomic_set(&mutex->val, 0);
+		}
+	}
+
+	z_reschedule(&data->lock, key);
+
+	return ret;
 }
 
 static inline int z_vrfy_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
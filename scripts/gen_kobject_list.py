@@ -647,7 +647,7 @@ def find_kobjects(elf, syms):
             ko.data = thread_counter
             thread_counter = thread_counter + 1
         elif ko.type_obj.name == "sys_mutex":
-            ko.data = "&kernel_mutexes[%d]" % sys_mutex_counter
+            ko.data = "&sys_mutex_data[%d]" % sys_mutex_counter
             sys_mutex_counter += 1
         elif ko.type_obj.name == "k_futex":
             ko.data = "&futex_data[%d]" % futex_counter
@@ -747,10 +747,10 @@ void z_object_wordlist_foreach(_wordlist_cb_func_t func, void *context)
 def write_gperf_table(fp, syms, objs, little_endian, static_begin, static_end):
     fp.write(header)
     if sys_mutex_counter != 0:
-        fp.write("static struct k_mutex kernel_mutexes[%d] = {\n"
+        fp.write("static struct z_sys_mutex_data sys_mutex_data[%d] = {\n"
                  % sys_mutex_counter)
         for i in range(sys_mutex_counter):
-            fp.write("Z_MUTEX_INITIALIZER(kernel_mutexes[%d])" % i)
+            fp.write("Z_SYS_MUTEX_DATA_INITIALIZER(sys_mutex_data[%d])" % i)
             if i != sys_mutex_counter - 1:
                 fp.write(", ")
         fp.write("};\n")
@@ -766,7 +766,7 @@ def write_gperf_table(fp, syms, objs, little_endian, static_begin, static_end):
 
     metadata_names = {
         "K_OBJ_THREAD" : "thread_id",
-        "K_OBJ_SYS_MUTEX" : "mutex",
+        "K_OBJ_SYS_MUTEX" : "sys_mutex_data",
         "K_OBJ_FUTEX" : "futex_data"
     }
 
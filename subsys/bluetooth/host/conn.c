@@ -95,6 +95,75 @@ struct k_sem *bt_conn_get_pkts(struct bt_conn *conn)
 	return &bt_dev.le.acl_pkts;
 }
 
+enum {
+	FRAG_START,
+	FRAG_CONT,
+	FRAG_SINGLE,
+	FRAG_END
+};
+
+#if defined(CONFIG_BT_CONN_TX_STATS)
+static void tx_stats_queued(struct bt_conn *conn)
+{
+	uint32_t queued = atomic_inc(&conn->tx_stats.queued) + 1;
+
+	if (queued > conn->tx_stats.max_queued) {
+		conn->tx_stats.max_queued = queued;
+	}
+}
+
+static void tx_stats_dequeued(struct bt_conn *conn)
+{
+	atomic_dec(&conn->tx_stats.queued);
+}
+
+static void tx_stats_in_flight(struct bt_conn *conn)
+{
+	uint32_t in_flight = atomic_inc(&conn->tx_stats.in_flight) + 1;
+
+	if (in_flight > conn->tx_stats.max_in_flight) {
+		conn->tx_stats.max_in_flight = in_flight;
+	}
+}
+
+static void tx_stats_sent(struct bt_conn *conn, uint8_t flags, int err)
+{
+	if (err) {
+		atomic_dec(&conn->tx_stats.in_flight);
+		return;
+	}
+
+	conn->tx_stats.fragments++;
+
+	if (flags == FRAG_SINGLE || flags == FRAG_END) {
+		conn->tx_stats.sent++;
+	}
+}
+
+static void tx_stats_stall(struct bt_conn *conn)
+{
+	conn->tx_stats.credit_stalls++;
+}
+
+static void tx_stats_unack(struct bt_conn *conn)
+{
+	atomic_set(&conn->tx_stats.in_flight, 0);
+}
+
+void bt_conn_tx_stats_completed(struct bt_conn *conn, uint16_t count)
+{
+	atomic_sub(&conn->tx_stats.in_flight, count);
+}
+#else
+static inline void tx_stats_queued(struct bt_conn *conn) {}
+static inline void tx_stats_dequeued(struct bt_conn *conn) {}
+static inline void tx_stats_in_flight(struct bt_conn *conn) {}
+static inline void tx_stats_sent(struct bt_conn *conn, uint8_t flags,
+				 int err) {}
+static inline void tx_stats_stall(struct bt_conn *conn) {}
+static inline void tx_stats_unack(struct bt_conn *conn) {}
+#endif /* CONFIG_BT_CONN_TX_STATS */
+
 static inline const char *state2str(bt_conn_state_t state)
 {
 	switch (state) {
@@ -1076,17 +1145,11 @@ int bt_conn_send_cb(struct bt_conn *conn, struct net_buf *buf,
 		tx_data(buf)->tx = NULL;
 	}
 
+	tx_stats_queued(conn);
 	net_buf_put(&conn->tx_queue, buf);
 	return 0;
 }
 
-enum {
-	FRAG_START,
-	FRAG_CONT,
-	FRAG_SINGLE,
-	FRAG_END
-};
-
 static int send_acl(struct bt_conn *conn, struct net_buf *buf, uint8_t flags)
 {
 	struct bt_hci_acl_hdr *hdr;
@@ -1155,8 +1218,16 @@ static bool send_frag(struct bt_conn *conn, struct net_buf *buf, uint8_t flags,
 	BT_DBG("conn %p buf %p len %u flags 0x%02x", conn, buf, buf->len,
 	       flags);
 
-	/* Wait until the controller can accept ACL packets */
-	k_sem_take(bt_conn_get_pkts(conn), K_FOREVER);
+	/* Wait until the controller can accept ACL packets, the TX scheduler
+	 * only gets here after it took the controller buffer itself.
+	 */
+	if (!IS_ENABLED(CONFIG_BT_CONN_TX_SCHED)) {
+		if (!k_sem_count_get(bt_conn_get_pkts(conn))) {
+			tx_stats_stall(conn);
+		}
+
+		k_sem_take(bt_conn_get_pkts(conn), K_FOREVER);
+	}
 
 	/* Check for disconnection while waiting for pkts_sem */
 	if (conn->state != BT_CONN_CONNECTED) {
@@ -1181,12 +1252,19 @@ static bool send_frag(struct bt_conn *conn, struct net_buf *buf, uint8_t flags,
 	}
 	irq_unlock(key);
 
+	/* Counted before sending, the controller may complete the packet
+	 * before bt_send() returns.
+	 */
+	tx_stats_in_flight(conn);
+
 	if (IS_ENABLED(CONFIG_BT_ISO) && conn->type == BT_CONN_TYPE_ISO) {
 		err = send_iso(conn, buf, flags);
 	} else {
 		err = send_acl(conn, buf, flags);
 	}
 
+	tx_stats_sent(conn, flags, err);
+
 	if (err) {
 		BT_ERR("Unable to send to driver (err %d)", err);
 		key = irq_lock();
@@ -1309,6 +1387,8 @@ static void conn_cleanup(struct bt_conn *conn)
 
 	/* Give back any allocated buffers */
 	while ((buf = net_buf_get(&conn->tx_queue, K_NO_WAIT))) {
+		tx_stats_dequeued(conn);
+
 		if (tx_data(buf)->tx) {
 			tx_free(tx_data(buf)->tx);
 		}
@@ -1316,6 +1396,20 @@ static void conn_cleanup(struct bt_conn *conn)
 		net_buf_unref(buf);
 	}
 
+#if defined(CONFIG_BT_CONN_TX_SCHED)
+	/* Drop the remainder of a partially sent packet */
+	buf = conn->tx_frag;
+	if (buf) {
+		conn->tx_frag = NULL;
+
+		if (tx_data(buf)->tx) {
+			tx_free(tx_data(buf)->tx);
+		}
+
+		net_buf_unref(buf);
+	}
+#endif /* CONFIG_BT_CONN_TX_SCHED */
+
 	__ASSERT(sys_slist_is_empty(&conn->tx_pending), "Pending TX packets");
 	__ASSERT_NO_MSG(conn->pending_no_cb == 0);
 
@@ -1324,6 +1418,17 @@ static void conn_cleanup(struct bt_conn *conn)
 	k_work_reschedule(&conn->deferred_work, K_NO_WAIT);
 }
 
+static bool tx_sched_pending(struct bt_conn *conn)
+{
+#if defined(CONFIG_BT_CONN_TX_SCHED)
+	if (conn->tx_frag) {
+		return true;
+	}
+#endif /* CONFIG_BT_CONN_TX_SCHED */
+
+	return !k_fifo_is_empty(&conn->tx_queue);
+}
+
 static int conn_prepare_events(struct bt_conn *conn,
 			       struct k_poll_event *events)
 {
@@ -1343,6 +1448,19 @@ static int conn_prepare_events(struct bt_conn *conn,
 
 	BT_DBG("Adding conn %p to poll list", conn);
 
+	/* With data waiting for transmission, what the TX scheduler needs
+	 * next is a free controller buffer.
+	 */
+	if (IS_ENABLED(CONFIG_BT_CONN_TX_SCHED) && tx_sched_pending(conn)) {
+		k_poll_event_init(&events[0],
+				  K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY,
+				  bt_conn_get_pkts(conn));
+		events[0].tag = BT_EVENT_CONN_TX_CREDITS;
+
+		return 0;
+	}
+
 	k_poll_event_init(&events[0],
 			K_POLL_TYPE_FIFO_DATA_AVAILABLE,
 			K_POLL_MODE_NOTIFY_ONLY,
@@ -1400,11 +1518,132 @@ void bt_conn_process_tx(struct bt_conn *conn)
 	/* Get next ACL packet for connection */
 	buf = net_buf_get(&conn->tx_queue, K_NO_WAIT);
 	BT_ASSERT(buf);
+	tx_stats_dequeued(conn);
 	if (!send_buf(conn, buf)) {
 		net_buf_unref(buf);
 	}
 }
 
+#if defined(CONFIG_BT_CONN_TX_SCHED)
+#if defined(CONFIG_BT_ISO)
+#define TX_SCHED_CONNS (ARRAY_SIZE(acl_conns) + ARRAY_SIZE(iso_conns))
+#else
+#define TX_SCHED_CONNS ARRAY_SIZE(acl_conns)
+#endif /* CONFIG_BT_ISO */
+
+/* Connection served first by the next scheduler run */
+static uint8_t tx_sched_next;
+
+static struct bt_conn *tx_sched_conn(uint8_t index)
+{
+#if defined(CONFIG_BT_ISO)
+	if (index >= ARRAY_SIZE(acl_conns)) {
+		return &iso_conns[index - ARRAY_SIZE(acl_conns)];
+	}
+#endif /* CONFIG_BT_ISO */
+
+	return &acl_conns[index];
+}
+
+static void tx_sched_drop(struct bt_conn *conn, struct net_buf *buf)
+{
+	conn->tx_frag = NULL;
+
+	if (tx_data(buf)->tx) {
+		tx_free(tx_data(buf)->tx);
+	}
+
+	net_buf_unref(buf);
+}
+
+/* Send the next HCI data packet of a connection, using the controller
+ * buffer already taken by the caller.
+ */
+static void tx_sched_send(struct bt_conn *conn)
+{
+	struct net_buf *buf = conn->tx_frag;
+	struct net_buf *frag;
+	uint8_t flags;
+
+	if (!buf) {
+		buf = net_buf_get(&conn->tx_queue, K_NO_WAIT);
+		if (!buf) {
+			k_sem_give(bt_conn_get_pkts(conn));
+			return;
+		}
+
+		tx_stats_dequeued(conn);
+
+		/* Send directly if the packet fits the ACL MTU */
+		if (buf->len <= conn_mtu(conn)) {
+			if (!send_frag(conn, buf, FRAG_SINGLE, false)) {
+				net_buf_unref(buf);
+			}
+
+			return;
+		}
+
+		flags = FRAG_START;
+	} else if (buf->len <= conn_mtu(conn)) {
+		/* The last fragment is the original buffer */
+		conn->tx_frag = NULL;
+		if (!send_frag(conn, buf, FRAG_END, false)) {
+			net_buf_unref(buf);
+		}
+
+		return;
+	} else {
+		flags = FRAG_CONT;
+	}
+
+	frag = create_frag(conn, buf);
+	if (!frag) {
+		k_sem_give(bt_conn_get_pkts(conn));
+		tx_sched_drop(conn, buf);
+		return;
+	}
+
+	if (!send_frag(conn, frag, flags, true)) {
+		tx_sched_drop(conn, buf);
+		return;
+	}
+
+	/* Continued on the next turn of the connection */
+	conn->tx_frag = buf;
+}
+
+void bt_conn_tx_sched_run(void)
+{
+	uint8_t next = tx_sched_next;
+	uint8_t i;
+
+	/* One HCI data packet per connection and turn, as long as the
+	 * controller has buffers. The connections left without one are
+	 * served first next time.
+	 */
+	for (i = 0U; i < TX_SCHED_CONNS; i++) {
+		uint8_t index = (tx_sched_next + i) % TX_SCHED_CONNS;
+		struct bt_conn *conn = tx_sched_conn(index);
+
+		if (!atomic_get(&conn->ref) ||
+		    conn->state != BT_CONN_CONNECTED ||
+		    !tx_sched_pending(conn)) {
+			continue;
+		}
+
+		if (k_sem_take(bt_conn_get_pkts(conn), K_NO_WAIT)) {
+			tx_stats_stall(conn);
+			continue;
+		}
+
+		tx_sched_send(conn);
+		next = index + 1U;
+	}
+
+	tx_sched_next = next % TX_SCHED_CONNS;
+}
+#endif /* CONFIG_BT_CONN_TX_SCHED */
+
 bool bt_conn_exists_le(uint8_t id, const bt_addr_le_t *peer)
 {
 	struct bt_conn *conn = bt_conn_lookup_addr_le(id, peer);
@@ -1449,6 +1688,8 @@ struct bt_conn *bt_conn_add_le(uint8_t id, const bt_addr_le_t *peer)
 
 static void process_unack_tx(struct bt_conn *conn)
 {
+	tx_stats_unack(conn);
+
 	/* Return any unacknowledged packets */
 	while (1) {
 		struct bt_conn_tx *tx;
@@ -1947,6 +2188,27 @@ int bt_conn_get_info(const struct bt_conn *conn, struct bt_conn_info *info)
 	return -EINVAL;
 }
 
+int bt_conn_tx_stats_get(struct bt_conn *conn, struct bt_conn_tx_stats *stats)
+{
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	struct k_sem *pkts = bt_conn_get_pkts(conn);
+
+	stats->queued = atomic_get(&conn->tx_stats.queued);
+	stats->max_queued = conn->tx_stats.max_queued;
+	stats->sent = conn->tx_stats.sent;
+	stats->fragments = conn->tx_stats.fragments;
+	stats->in_flight = atomic_get(&conn->tx_stats.in_flight);
+	stats->max_in_flight = conn->tx_stats.max_in_flight;
+	stats->credit_stalls = conn->tx_stats.credit_stalls;
+	stats->credits = pkts->limit;
+	stats->credits_free = k_sem_count_get(pkts);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif /* CONFIG_BT_CONN_TX_STATS */
+}
+
 int bt_conn_get_remote_info(struct bt_conn *conn,
 			    struct bt_conn_remote_info *remote_info)
 {
@@ -179,6 +179,23 @@ struct bt_conn {
 	/* Queue for outgoing ACL data */
 	struct k_fifo		tx_queue;
 
+#if defined(CONFIG_BT_CONN_TX_SCHED)
+	/* Packet partially sent by the TX scheduler */
+	struct net_buf		*tx_frag;
+#endif /* CONFIG_BT_CONN_TX_SCHED */
+
+#if defined(CONFIG_BT_CONN_TX_STATS)
+	struct {
+		atomic_t	queued;
+		atomic_t	in_flight;
+		uint32_t	max_queued;
+		uint32_t	max_in_flight;
+		uint32_t	sent;
+		uint32_t	fragments;
+		uint32_t	credit_stalls;
+	} tx_stats;
+#endif /* CONFIG_BT_CONN_TX_STATS */
+
 	/* Active L2CAP/ISO channels */
 	sys_slist_t		channels;
 
@@ -402,3 +419,9 @@ struct k_sem *bt_conn_get_pkts(struct bt_conn *conn);
 /* k_poll related helpers for the TX thread */
 int bt_conn_prepare_events(struct k_poll_event events[]);
 void bt_conn_process_tx(struct bt_conn *conn);
+
+/* Send the next ACL packet of each connection that has one */
+void bt_conn_tx_sched_run(void);
+
+/* Account for ACL packets completed by the controller */
+void bt_conn_tx_stats_completed(struct bt_conn *conn, uint16_t count);
@@ -81,6 +81,60 @@ static sys_slist_t db;
 static atomic_t init;
 static atomic_t service_init;
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+#define ATTR_INDEX_SIZE CONFIG_BT_GATT_ATTR_INDEX_SIZE
+
+/* Attributes indexed by handle - 1, along with a hash of their UUID so that
+ * searches by type only need to look at the attributes that may match.
+ */
+static const struct bt_gatt_attr *attr_index[ATTR_INDEX_SIZE];
+static uint8_t attr_index_uuid[ATTR_INDEX_SIZE];
+static bool attr_index_ready;
+
+/* UUIDs that compare equal hash to the same value regardless of their type,
+ * 16 and 32-bit UUIDs are aliases of 128-bit ones built on the base UUID.
+ */
+static uint8_t uuid_hash(const struct bt_uuid *uuid)
+{
+	uint32_t val;
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		val = BT_UUID_16(uuid)->val;
+		break;
+	case BT_UUID_TYPE_32:
+		val = BT_UUID_32(uuid)->val;
+		break;
+	case BT_UUID_TYPE_128:
+		val = sys_get_le32(&BT_UUID_128(uuid)->val[12]);
+		break;
+	default:
+		return 0;
+	}
+
+	val ^= val >> 16;
+
+	return (uint8_t)(val ^ (val >> 8));
+}
+
+static void attr_index_set(uint16_t handle, const struct bt_gatt_attr *attr)
+{
+	if (handle == 0U || handle > ATTR_INDEX_SIZE) {
+		return;
+	}
+
+	attr_index[handle - 1] = attr;
+	attr_index_uuid[handle - 1] = attr ? uuid_hash(attr->uuid) : 0U;
+}
+#else
+static inline void attr_index_set(uint16_t handle,
+				  const struct bt_gatt_attr *attr)
+{
+	ARG_UNUSED(handle);
+	ARG_UNUSED(attr);
+}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 static ssize_t read_name(struct bt_conn *conn, const struct bt_gatt_attr *attr,
 			 void *buf, uint16_t len, uint16_t offset)
 {
@@ -870,6 +924,12 @@ static const struct bt_gatt_attr *find_attr(uint16_t handle)
 {
 	const struct bt_gatt_attr *attr = NULL;
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+	if (attr_index_ready && handle != 0U && handle <= ATTR_INDEX_SIZE) {
+		return attr_index[handle - 1];
+	}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 	bt_gatt_foreach_attr(handle, handle, found_attr, &attr);
 
 	return attr;
@@ -937,6 +997,10 @@ populate:
 		       attrs->perm);
 	}
 
+	for (uint16_t i = 0; i < svc->attr_count; i++) {
+		attr_index_set(svc->attrs[i].handle, &svc->attrs[i]);
+	}
+
 	gatt_insert(svc, last_handle);
 
 	return 0;
@@ -1094,8 +1158,17 @@ static void bt_gatt_service_init(void)
 	}
 
 	Z_STRUCT_SECTION_FOREACH(bt_gatt_service_static, svc) {
+		for (size_t i = 0; i < svc->attr_count; i++) {
+			attr_index_set(last_static_handle + 1 + i,
+				       &svc->attrs[i]);
+		}
+
 		last_static_handle += svc->attr_count;
 	}
+
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+	attr_index_ready = true;
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
 }
 
 void bt_gatt_init(void)
@@ -1232,6 +1305,8 @@ static int gatt_unregister(struct bt_gatt_service *svc)
 	for (uint16_t i = 0; i < svc->attr_count; i++) {
 		struct bt_gatt_attr *attr = &svc->attrs[i];
 
+		attr_index_set(attr->handle, NULL);
+
 		if (attr->write == bt_gatt_attr_write_ccc) {
 			gatt_unregister_ccc(attr->user_data);
 		}
@@ -1565,6 +1640,51 @@ static void foreach_attr_type_dyndb(uint16_t start_handle, uint16_t end_handle,
 #endif /* CONFIG_BT_GATT_DYNAMIC_DB */
 }
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+static uint8_t foreach_attr_type_index(uint16_t start_handle,
+				       uint16_t end_handle,
+				       const struct bt_uuid *uuid,
+				       const void *attr_data,
+				       uint16_t *num_matches,
+				       bt_gatt_attr_func_t func,
+				       void *user_data)
+{
+	uint32_t last = MIN(end_handle, ATTR_INDEX_SIZE);
+	uint8_t hash = uuid ? uuid_hash(uuid) : 0U;
+
+	for (uint32_t handle = MAX(start_handle, 1U); handle <= last;
+	     handle++) {
+		const struct bt_gatt_attr *attr;
+
+		if (uuid) {
+			/* Jump to the next attribute that may match */
+			const uint8_t *next;
+
+			next = memchr(&attr_index_uuid[handle - 1], hash,
+				      last - handle + 1);
+			if (!next) {
+				break;
+			}
+
+			handle = next - attr_index_uuid + 1;
+		}
+
+		attr = attr_index[handle - 1];
+		if (!attr) {
+			continue;
+		}
+
+		if (gatt_foreach_iter(attr, handle, start_handle, end_handle,
+				      uuid, attr_data, num_matches, func,
+				      user_data) == BT_GATT_ITER_STOP) {
+			return BT_GATT_ITER_STOP;
+		}
+	}
+
+	return BT_GATT_ITER_CONTINUE;
+}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 			       const struct bt_uuid *uuid,
 			       const void *attr_data, uint16_t num_matches,
@@ -1576,6 +1696,20 @@ void bt_gatt_foreach_attr_type(uint16_t start_handle, uint16_t end_handle,
 		num_matches = UINT16_MAX;
 	}
 
+#if defined(CONFIG_BT_GATT_ATTR_INDEX)
+	if (attr_index_ready && start_handle <= ATTR_INDEX_SIZE) {
+		if (foreach_attr_type_index(start_handle, end_handle, uuid,
+					    attr_data, &num_matches, func,
+					    user_data) == BT_GATT_ITER_STOP ||
+		    end_handle <= ATTR_INDEX_SIZE) {
+			return;
+		}
+
+		/* Handles past the index are found the regular way */
+		start_handle = ATTR_INDEX_SIZE + 1;
+	}
+#endif /* CONFIG_BT_GATT_ATTR_INDEX */
+
 	if (start_handle <= last_static_handle) {
 		uint16_t handle = 1;
 
@@ -1873,6 +2007,17 @@ static void notify_mult_process(struct k_work *work)
 
 K_WORK_DEFINE(nfy_mult_work, notify_mult_process);
 
+#if defined(CONFIG_BT_GATT_NOTIFY_FANOUT)
+static void gatt_notify_mult_flush(struct bt_conn *conn)
+{
+	struct net_buf **buf = &nfy_mult[bt_conn_index(conn)];
+
+	if (*buf) {
+		(void)gatt_notify_mult_send(conn, buf);
+	}
+}
+#endif /* CONFIG_BT_GATT_NOTIFY_FANOUT */
+
 static bool gatt_cf_notify_multi(struct bt_conn *conn)
 {
 	struct gatt_cf_cfg *cfg;
@@ -1959,7 +2104,7 @@ static int gatt_notify(struct bt_conn *conn, uint16_t handle,
 		int err;
 
 		err = gatt_notify_mult(conn, handle, params);
-		if (err && err != -ENOMEM) {
+		if (err != -ENOMEM) {
 			return err;
 		}
 	}
@@ -2246,45 +2391,58 @@ static bool gatt_find_by_uuid(struct notify_data *found,
 	return found->attr ? true : false;
 }
 
-int bt_gatt_notify_cb(struct bt_conn *conn,
-		      struct bt_gatt_notify_params *params)
+/* Resolve the attribute and value handle to be notified */
+static int notify_resolve(struct notify_data *data,
+			  struct bt_gatt_notify_params *params)
 {
-	struct notify_data data;
-
-	__ASSERT(params, "invalid parameters\n");
-	__ASSERT(params->attr, "invalid parameters\n");
-
-	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
-		return -EAGAIN;
-	}
-
-	data.attr = params->attr;
-
-	if (conn && conn->state != BT_CONN_CONNECTED) {
-		return -ENOTCONN;
-	}
+	data->attr = params->attr;
 
-	data.handle = bt_gatt_attr_get_handle(data.attr);
-	if (!data.handle) {
+	data->handle = bt_gatt_attr_get_handle(data->attr);
+	if (!data->handle) {
 		return -ENOENT;
 	}
 
 	/* Lookup UUID if it was given */
 	if (params->uuid) {
-		if (!gatt_find_by_uuid(&data, params->uuid)) {
+		if (!gatt_find_by_uuid(data, params->uuid)) {
 			return -ENOENT;
 		}
 	}
 
 	/* Check if attribute is a characteristic then adjust the handle */
-	if (!bt_uuid_cmp(data.attr->uuid, BT_UUID_GATT_CHRC)) {
-		struct bt_gatt_chrc *chrc = data.attr->user_data;
+	if (!bt_uuid_cmp(data->attr->uuid, BT_UUID_GATT_CHRC)) {
+		struct bt_gatt_chrc *chrc = data->attr->user_data;
 
 		if (!(chrc->properties & BT_GATT_CHRC_NOTIFY)) {
 			return -EINVAL;
 		}
 
-		data.handle = bt_gatt_attr_value_handle(data.attr);
+		data->handle = bt_gatt_attr_value_handle(data->attr);
+	}
+
+	return 0;
+}
+
+int bt_gatt_notify_cb(struct bt_conn *conn,
+		      struct bt_gatt_notify_params *params)
+{
+	struct notify_data data;
+	int err;
+
+	__ASSERT(params, "invalid parameters\n");
+	__ASSERT(params->attr, "invalid parameters\n");
+
+	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
+		return -EAGAIN;
+	}
+
+	if (conn && conn->state != BT_CONN_CONNECTED) {
+		return -ENOTCONN;
+	}
+
+	err = notify_resolve(&data, params);
+	if (err) {
+		return err;
 	}
 
 	if (conn) {
@@ -2322,6 +2480,123 @@ int bt_gatt_notify_multiple(struct bt_conn *conn, uint16_t num_params,
 }
 #endif /* CONFIG_BT_GATT_NOTIFY_MULTIPLE */
 
+#if defined(CONFIG_BT_GATT_NOTIFY_FANOUT)
+/* Number of notifications resolved before going through the connections */
+#define NOTIFY_FANOUT_CHUNK 8
+
+struct notify_fanout {
+	struct bt_gatt_notify_params *params;
+	const struct bt_gatt_attr *ccc;
+	uint16_t handle;
+};
+
+struct notify_fanout_data {
+	struct notify_fanout entries[NOTIFY_FANOUT_CHUNK];
+	uint16_t count;
+	int err;
+};
+
+static bool ccc_notify_enabled(struct bt_conn *conn,
+			       const struct bt_gatt_attr *attr)
+{
+	struct _bt_gatt_ccc *ccc = attr->user_data;
+	struct bt_gatt_ccc_cfg *cfg;
+
+	cfg = find_ccc_cfg(conn, ccc);
+	if (!cfg || cfg->value != BT_GATT_CCC_NOTIFY) {
+		return false;
+	}
+
+	/* Confirm match if cfg is managed by application */
+	return !ccc->cfg_match || ccc->cfg_match(conn, attr);
+}
+
+static void notify_fanout_conn(struct bt_conn *conn, void *user_data)
+{
+	struct notify_fanout_data *data = user_data;
+
+	if (conn->state != BT_CONN_CONNECTED) {
+		return;
+	}
+
+	for (uint16_t i = 0; i < data->count; i++) {
+		struct notify_fanout *entry = &data->entries[i];
+		int err;
+
+		if (!ccc_notify_enabled(conn, entry->ccc)) {
+			continue;
+		}
+
+		err = gatt_notify(conn, entry->handle, entry->params);
+		if (err < 0) {
+			/* Only reported if no peer could be notified */
+			if (data->err) {
+				data->err = err;
+			}
+			break;
+		}
+
+		data->err = 0;
+	}
+
+#if defined(CONFIG_BT_GATT_NOTIFY_MULTIPLE)
+	/* Don't wait for the work item to send what was coalesced */
+	gatt_notify_mult_flush(conn);
+#endif /* CONFIG_BT_GATT_NOTIFY_MULTIPLE */
+}
+
+int bt_gatt_notify_fanout(uint16_t num_params,
+			  struct bt_gatt_notify_params *params)
+{
+	struct notify_fanout_data data;
+
+	__ASSERT(params, "invalid parameters\n");
+	__ASSERT(num_params, "invalid parameters\n");
+
+	if (!atomic_test_bit(bt_dev.flags, BT_DEV_READY)) {
+		return -EAGAIN;
+	}
+
+	data.err = -ENOTCONN;
+
+	while (num_params) {
+		data.count = 0U;
+
+		for (; num_params && data.count < NOTIFY_FANOUT_CHUNK;
+		     num_params--, params++) {
+			struct notify_data nfy, ccc;
+			int err;
+
+			__ASSERT(params->attr, "invalid parameters\n");
+
+			err = notify_resolve(&nfy, params);
+			if (err) {
+				return err;
+			}
+
+			/* Lookup the CCC descriptor once for all peers */
+			ccc.handle = nfy.handle;
+			if (!gatt_find_by_uuid(&ccc, BT_UUID_GATT_CCC) ||
+			    ccc.attr->write != bt_gatt_attr_write_ccc) {
+				continue;
+			}
+
+			data.entries[data.count].params = params;
+			data.entries[data.count].ccc = ccc.attr;
+			data.entries[data.count].handle = nfy.handle;
+			data.count++;
+		}
+
+		if (data.count) {
+			bt_conn_foreach(BT_CONN_TYPE_LE, notify_fanout_conn,
+					&data);
+		}
+	}
+
+	return data.err;
+}
+#endif /* CONFIG_BT_GATT_NOTIFY_FANOUT */
+
 int bt_gatt_indicate(struct bt_conn *conn,
 		     struct bt_gatt_indicate_params *params)
 {
@@ -434,6 +434,10 @@ static void hci_num_completed_packets(struct net_buf *buf)
 			continue;
 		}
 
+		if (IS_ENABLED(CONFIG_BT_CONN_TX_STATS)) {
+			bt_conn_tx_stats_completed(conn, count);
+		}
+
 		while (count--) {
 			struct bt_conn_tx *tx;
 			sys_snode_t *node;
@@ -2352,13 +2356,20 @@ static void process_events(struct k_poll_event *ev, int count)
 		switch (ev->state) {
 		case K_POLL_STATE_SIGNALED:
 			break;
+		case K_POLL_STATE_SEM_AVAILABLE:
+			/* Controller buffers freed, see bt_conn_tx_sched_run() */
+			break;
 		case K_POLL_STATE_FIFO_DATA_AVAILABLE:
 			if (ev->tag == BT_EVENT_CMD_TX) {
 				send_cmd();
 			} else if (IS_ENABLED(CONFIG_BT_CONN)) {
 				struct bt_conn *conn;
 
-				if (ev->tag == BT_EVENT_CONN_TX_QUEUE) {
+				/* The TX scheduler serves all connections at
+				 * once after the events are processed.
+				 */
+				if (ev->tag == BT_EVENT_CONN_TX_QUEUE &&
+				    !IS_ENABLED(CONFIG_BT_CONN_TX_SCHED)) {
 					conn = CONTAINER_OF(ev->fifo,
 							    struct bt_conn,
 							    tx_queue);
@@ -2416,6 +2427,10 @@ static void hci_tx_thread(void *p1, void *p2, void *p3)
 
 		process_events(events, ev_count);
 
+		if (IS_ENABLED(CONFIG_BT_CONN_TX_SCHED)) {
+			bt_conn_tx_sched_run();
+		}
+
 		/* Make sure we don't hog the CPU if there's all the time
 		 * some ready events.
 		 */
@@ -0,0 +1,272 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Compressed RAM backing store
+ */
+#include <mmu.h>
+#include <string.h>
+#include <kernel_arch_interface.h>
+#include <sys/mem_manage.h>
+#include "lz4_block.h"
+
+/*
+ * Evicted pages are kept in RAM like with the RAM backing store, but
+ * compressed, so that the memory set aside for the backing store holds
+ * more pages than it has page-sized blocks.
+ *
+ * A location token is the index of a slot describing one stored page. The
+ * data of a page is stored in fixed size chunks allocated from a memory
+ * slab; a page occupies as many chunks as its compressed size needs:
+ *
+ * - pages consisting only of zeroes take no chunk at all,
+ * - other pages are LZ4 compressed,
+ * - pages whose compressed size would not save at least one chunk are
+ *   stored uncompressed.
+ *
+ * The size of a page is only known once k_mem_paging_backing_store_page_out()
+ * runs, which cannot fail, so k_mem_paging_backing_store_location_get()
+ * reserves chunks for an uncompressed page and page-out releases what it
+ * did not use.
+ *
+ * As with the RAM backing store, locations are freed as soon as pages are
+ * paged in, so clean pages are never kept in the backing store.
+ *
+ * Calls are serialized by the paging code, so the static compression
+ * buffers need no locking.
+ */
+
+#define CHUNK_SIZE	CONFIG_BACKING_STORE_COMPRESSED_RAM_CHUNK_SIZE
+#define NUM_CHUNKS	(CONFIG_BACKING_STORE_COMPRESSED_RAM_POOL_SIZE / CHUNK_SIZE)
+#define NUM_SLOTS	CONFIG_BACKING_STORE_COMPRESSED_RAM_SLOTS
+#define PAGE_CHUNKS	(CONFIG_MMU_PAGE_SIZE / CHUNK_SIZE)
+#define HASH_LOG	10
+
+BUILD_ASSERT((CONFIG_MMU_PAGE_SIZE % CHUNK_SIZE) == 0,
+	     "chunk size must divide the page size");
+BUILD_ASSERT(CONFIG_MMU_PAGE_SIZE < 65536,
+	     "pages must be smaller than 64 KiB for LZ4 offsets");
+BUILD_ASSERT(NUM_CHUNKS >= 2 * PAGE_CHUNKS,
+	     "pool must hold at least two uncompressed pages");
+
+enum slot_type {
+	SLOT_FREE,
+	/* Reserved by location_get(), not yet written */
+	SLOT_RESERVED,
+	SLOT_ZERO,
+	SLOT_LZ4,
+	SLOT_RAW,
+};
+
+struct slot {
+	uint8_t type;
+	uint8_t num_chunks;
+	/* Compressed size in bytes for SLOT_LZ4 */
+	uint16_t size;
+	void *chunks[PAGE_CHUNKS];
+};
+
+static char __aligned(sizeof(void *)) pool[NUM_CHUNKS * CHUNK_SIZE];
+static struct k_mem_slab chunk_slab;
+static struct slot slots[NUM_SLOTS];
+
+static size_t free_slots;
+/* Chunks free in the slab and not reserved for pending page-outs */
+static size_t avail_chunks;
+
+static uint8_t work_buf[CONFIG_MMU_PAGE_SIZE];
+static uint16_t hash_table[LZ4_HASH_TABLE_SIZE(HASH_LOG)];
+
+static struct k_mem_paging_backing_store_compressed_stats stats;
+
+static struct slot *location_to_slot(uintptr_t location)
+{
+	__ASSERT(location < NUM_SLOTS, "bad location 0x%lx", location);
+
+	return &slots[location];
+}
+
+static bool page_is_zero(const uint8_t *page)
+{
+	const unsigned long *word = (const unsigned long *)page;
+
+	for (size_t i = 0; i < CONFIG_MMU_PAGE_SIZE / sizeof(*word); i++) {
+		if (word[i] != 0UL) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+int k_mem_paging_backing_store_location_get(struct z_page_frame *pf,
+					    uintptr_t *location,
+					    bool page_fault)
+{
+	/* Like the RAM backing store, keep room for one page to be
+	 * evicted on a page fault.
+	 */
+	size_t reserve = page_fault ? 0 : 1;
+
+	if ((free_slots <= reserve) ||
+	    (avail_chunks < (reserve + 1) * PAGE_CHUNKS)) {
+		return -ENOMEM;
+	}
+
+	for (size_t i = 0; i < NUM_SLOTS; i++) {
+		if (slots[i].type == SLOT_FREE) {
+			slots[i].type = SLOT_RESERVED;
+			free_slots--;
+			avail_chunks -= PAGE_CHUNKS;
+			*location = i;
+			return 0;
+		}
+	}
+
+	__ASSERT(false, "slot count mismatch");
+
+	return -ENOMEM;
+}
+
+void k_mem_paging_backing_store_location_free(uintptr_t location)
+{
+	struct slot *slot = location_to_slot(location);
+
+	__ASSERT(slot->type != SLOT_FREE, "location 0x%lx already free",
+		 location);
+
+	if (slot->type == SLOT_RESERVED) {
+		avail_chunks += PAGE_CHUNKS;
+	} else {
+		for (size_t i = 0; i < slot->num_chunks; i++) {
+			k_mem_slab_free(&chunk_slab, &slot->chunks[i]);
+		}
+		avail_chunks += slot->num_chunks;
+
+		stats.pages_stored--;
+		stats.bytes_used -= slot->num_chunks * CHUNK_SIZE;
+	}
+
+	slot->type = SLOT_FREE;
+	slot->num_chunks = 0U;
+	free_slots++;
+}
+
+void k_mem_paging_backing_store_page_out(uintptr_t location)
+{
+	struct slot *slot = location_to_slot(location);
+	const uint8_t *data = Z_SCRATCH_PAGE;
+	size_t size = 0;
+	int ret;
+
+	__ASSERT(slot->type == SLOT_RESERVED, "location 0x%lx not reserved",
+		 location);
+
+	if (page_is_zero(data)) {
+		slot->type = SLOT_ZERO;
+		stats.zero_pages++;
+	} else {
+		/* Only worth it if at least one chunk is saved */
+		size = lz4_compress(data, CONFIG_MMU_PAGE_SIZE, work_buf,
+				    CONFIG_MMU_PAGE_SIZE - CHUNK_SIZE,
+				    hash_table, HASH_LOG);
+		if (size != 0U) {
+			slot->type = SLOT_LZ4;
+			slot->size = (uint16_t)size;
+			data = work_buf;
+			stats.lz4_pages++;
+		} else {
+			slot->type = SLOT_RAW;
+			size = CONFIG_MMU_PAGE_SIZE;
+			stats.raw_pages++;
+		}
+	}
+
+	slot->num_chunks = (uint8_t)DIV_ROUND_UP(size, CHUNK_SIZE);
+	for (size_t i = 0; i < slot->num_chunks; i++) {
+		size_t len = MIN(size - i * CHUNK_SIZE, CHUNK_SIZE);
+
+		ret = k_mem_slab_alloc(&chunk_slab, &slot->chunks[i],
+				       K_NO_WAIT);
+		__ASSERT(ret == 0, "chunk count mismatch");
+		(void)ret;
+		(void)memcpy(slot->chunks[i], data + i * CHUNK_SIZE, len);
+	}
+
+	/* Give back the part of the reservation that was not needed */
+	avail_chunks += PAGE_CHUNKS - slot->num_chunks;
+
+	stats.pages_stored++;
+	stats.bytes_used += slot->num_chunks * CHUNK_SIZE;
+	stats.page_outs++;
+	stats.bytes_in += CONFIG_MMU_PAGE_SIZE;
+	stats.bytes_out += size;
+}
+
+void k_mem_paging_backing_store_page_in(uintptr_t location)
+{
+	struct slot *slot = location_to_slot(location);
+	uint32_t start = k_cycle_get_32();
+	uint32_t cycles;
+	int ret;
+
+	switch (slot->type) {
+	case SLOT_ZERO:
+		(void)memset(Z_SCRATCH_PAGE, 0, CONFIG_MMU_PAGE_SIZE);
+		break;
+	case SLOT_RAW:
+		for (size_t i = 0; i < slot->num_chunks; i++) {
+			(void)memcpy((uint8_t *)Z_SCRATCH_PAGE + i * CHUNK_SIZE,
+				     slot->chunks[i], CHUNK_SIZE);
+		}
+		break;
+	case SLOT_LZ4:
+		/* Chunks are not contiguous, gather them first */
+		for (size_t i = 0; i < slot->num_chunks; i++) {
+			size_t len = MIN(slot->size - i * CHUNK_SIZE,
+					 CHUNK_SIZE);
+
+			(void)memcpy(work_buf + i * CHUNK_SIZE,
+				     slot->chunks[i], len);
+		}
+		ret = lz4_decompress(work_buf, slot->size, Z_SCRATCH_PAGE,
+				     CONFIG_MMU_PAGE_SIZE);
+		__ASSERT(ret == 0, "corrupted page at location 0x%lx",
+			 location);
+		(void)ret;
+		break;
+	default:
+		__ASSERT(false, "location 0x%lx holds no page", location);
+		break;
+	}
+
+	cycles = k_cycle_get_32() - start;
+	stats.page_ins++;
+	stats.page_in_cycles += cycles;
+	if (cycles > stats.page_in_cycles_max) {
+		stats.page_in_cycles_max = cycles;
+	}
+}
+
+void k_mem_paging_backing_store_page_finalize(struct z_page_frame *pf,
+					      uintptr_t location)
+{
+	k_mem_paging_backing_store_location_free(location);
+}
+
+void k_mem_paging_backing_store_compressed_stats_get(
+	struct k_mem_paging_backing_store_compressed_stats *out)
+{
+	int key = irq_lock();
+
+	*out = stats;
+	irq_unlock(key);
+}
+
+void k_mem_paging_backing_store_init(void)
+{
+	k_mem_slab_init(&chunk_slab, pool, CHUNK_SIZE, NUM_CHUNKS);
+	free_slots = NUM_SLOTS;
+	avail_chunks = NUM_CHUNKS;
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Minimal LZ4 block format compressor and decompressor for the compressed
+ * RAM backing store. Only what is needed to compress single pages is
+ * implemented: inputs must be smaller than 64 KiB.
+ */
+#ifndef ZEPHYR_SUBSYS_DEMAND_PAGING_BACKING_STORE_LZ4_BLOCK_H_
+#define ZEPHYR_SUBSYS_DEMAND_PAGING_BACKING_STORE_LZ4_BLOCK_H_
+
+#include <zephyr/types.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+
+#define LZ4_MIN_MATCH		4
+/* The last match must start at least this many bytes before the end */
+#define LZ4_MF_LIMIT		12
+/* The last bytes of the input are always literals */
+#define LZ4_LAST_LITERALS	5
+
+#define LZ4_HASH_TABLE_SIZE(hash_log)	(1U << (hash_log))
+
+static inline uint32_t lz4_read32(const uint8_t *p)
+{
+	uint32_t v;
+
+	(void)memcpy(&v, p, sizeof(v));
+
+	return v;
+}
+
+static inline uint32_t lz4_hash(uint32_t seq, unsigned int hash_log)
+{
+	return (seq * 2654435761U) >> (32U - hash_log);
+}
+
+/* Write a length extension for a nibble that saturated at 15 */
+static inline uint8_t *lz4_put_len(uint8_t *op, const uint8_t *oend,
+				   size_t len)
+{
+	while (len >= 255U) {
+		if (op >= oend) {
+			return NULL;
+		}
+		*op++ = 255U;
+		len -= 255U;
+	}
+
+	if (op >= oend) {
+		return NULL;
+	}
+	*op++ = (uint8_t)len;
+
+	return op;
+}
+
+/* Emit one sequence: literals [lit, lit + lit_len), then a match of
+ * match_len bytes at offset, or no match if match_len is 0.
+ */
+static inline uint8_t *lz4_put_seq(uint8_t *op, const uint8_t *oend,
+				   const uint8_t *lit, size_t lit_len,
+				   uint16_t offset, size_t match_len)
+{
+	uint8_t *token = op++;
+	size_t ml = (match_len != 0U) ? (match_len - LZ4_MIN_MATCH) : 0U;
+
+	if (op > oend) {
+		return NULL;
+	}
+
+	*token = (uint8_t)(((lit_len < 15U) ? lit_len : 15U) << 4);
+	if (lit_len >= 15U) {
+		op = lz4_put_len(op, oend, lit_len - 15U);
+		if (op == NULL) {
+			return NULL;
+		}
+	}
+
+	if ((size_t)(oend - op) < lit_len) {
+		return NULL;
+	}
+	(void)memcpy(op, lit, lit_len);
+	op += lit_len;
+
+	if (match_len == 0U) {
+		return op;
+	}
+
+	if ((oend - op) < 2) {
+		return NULL;
+	}
+	*op++ = (uint8_t)offset;
+	*op++ = (uint8_t)(offset >> 8);
+
+	*token |= (uint8_t)((ml < 15U) ? ml : 15U);
+	if (ml >= 15U) {
+		op = lz4_put_len(op, oend, ml - 15U);
+	}
+
+	return op;
+}
+
+/**
+ * Compress @p len bytes of @p src into at most @p cap bytes of @p dst.
+ *
+ * @param table scratch hash table of LZ4_HASH_TABLE_SIZE(@p hash_log)
+ * entries, contents need not be initialized
+ *
+ * @return compressed size, or 0 if the result does not fit in @p cap
+ */
+static inline size_t lz4_compress(const uint8_t *src, size_t len,
+				  uint8_t *dst, size_t cap,
+				  uint16_t *table, unsigned int hash_log)
+{
+	const uint8_t *oend = dst + cap;
+	uint8_t *op = dst;
+	size_t anchor = 0;
+	size_t ip = 0;
+
+	(void)memset(table, 0, LZ4_HASH_TABLE_SIZE(hash_log) * sizeof(*table));
+
+	if (len > LZ4_MF_LIMIT) {
+		size_t limit = len - LZ4_MF_LIMIT;
+
+		while (ip < limit) {
+			uint32_t seq = lz4_read32(src + ip);
+			uint32_t h = lz4_hash(seq, hash_log);
+			size_t ref = table[h];
+			size_t ml;
+
+			table[h] = (uint16_t)ip;
+
+			if ((ref >= ip) || (lz4_read32(src + ref) != seq)) {
+				ip++;
+				continue;
+			}
+
+			ml = LZ4_MIN_MATCH;
+			while ((ip + ml < len - LZ4_LAST_LITERALS) &&
+			       (src[ref + ml] == src[ip + ml])) {
+				ml++;
+			}
+
+			op = lz4_put_seq(op, oend, src + anchor, ip - anchor,
+					 (uint16_t)(ip - ref), ml);
+			if (op == NULL) {
+				return 0;
+			}
+
+			ip += ml;
+			anchor = ip;
+		}
+	}
+
+	op = lz4_put_seq(op, oend, src + anchor, len - anchor, 0, 0);
+	if (op == NULL) {
+		return 0;
+	}
+
+	return op - dst;
+}
+
+/**
+ * Decompress @p len bytes of @p src into exactly @p out_len bytes of
+ * @p dst.
+ *
+ * @return 0 on success, -EINVAL if the input is malformed
+ */
+static inline int lz4_decompress(const uint8_t *src, size_t len,
+				 uint8_t *dst, size_t out_len)
+{
+	const uint8_t *iend = src + len;
+	const uint8_t *ip = src;
+	uint8_t *op = dst;
+	uint8_t *oend = dst + out_len;
+
+	while (ip < iend) {
+		uint8_t token = *ip++;
+		size_t lit_len = token >> 4;
+		size_t ml = token & 0xFU;
+		size_t offset;
+		uint8_t b;
+
+		if (lit_len == 15U) {
+			do {
+				if (ip >= iend) {
+					return -EINVAL;
+				}
+				b = *ip++;
+				lit_len += b;
+			} while (b == 255U);
+		}
+
+		if (((size_t)(iend - ip) < lit_len) ||
+		    ((size_t)(oend - op) < lit_len)) {
+			return -EINVAL;
+		}
+		(void)memcpy(op, ip, lit_len);
+		ip += lit_len;
+		op += lit_len;
+
+		if (ip == iend) {
+			break;
+		}
+
+		if ((iend - ip) < 2) {
+			return -EINVAL;
+		}
+		offset = ip[0] | ((size_t)ip[1] << 8);
+		ip += 2;
+
+		if (ml == 15U) {
+			do {
+				if (ip >= iend) {
+					return -EINVAL;
+				}
+				b = *ip++;
+				ml += b;
+			} while (b == 255U);
+		}
+		ml += LZ4_MIN_MATCH;
+
+		if ((offset == 0U) || (offset > (size_t)(op - dst)) ||
+		    ((size_t)(oend - op) < ml)) {
+			return -EINVAL;
+		}
+
+		/* Byte by byte, matches may overlap their own output */
+		for (const uint8_t *ref = op - offset; ml > 0U; ml--) {
+			*op++ = *ref++;
+		}
+	}
+
+	return (op == oend) ? 0 : -EINVAL;
+}
+
+#endif /* ZEPHYR_SUBSYS_DEMAND_PAGING_BACKING_STORE_LZ4_BLOCK_H_ */
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * CLOCK (second chance) eviction algorithm for demand paging
+ */
+#include <kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+#include <init.h>
+
+/* The page frames form a circular list with a hand pointing at the next
+ * candidate. When a page frame is needed the hand sweeps forward: a page
+ * that was accessed since the hand last passed it has its accessed state
+ * cleared and is skipped (its second chance), the first page that was not
+ * accessed is selected.
+ *
+ * Each page visited either gets selected or loses its accessed state, so
+ * the hand moves by O(1) frames per eviction on average and never more
+ * than twice around the clock. No periodic timer is needed.
+ *
+ * With CONFIG_EVICTION_CLOCK_PREFER_CLEAN a not accessed but dirty page is
+ * only selected if no clean one is found within the next
+ * CONFIG_EVICTION_CLOCK_CLEAN_WINDOW page frames, sparing a write to the
+ * backing store while keeping the sweep bounded.
+ */
+static size_t clock_hand;
+
+static inline struct z_page_frame *clock_advance(void)
+{
+	struct z_page_frame *pf = &z_page_frames[clock_hand];
+
+	clock_hand++;
+	if (clock_hand == Z_NUM_PAGE_FRAMES) {
+		clock_hand = 0;
+	}
+
+	return pf;
+}
+
+struct z_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct z_page_frame *dirty_pf = NULL;
+	struct z_page_frame *pf;
+	size_t dirty_at = 0;
+	uintptr_t flags;
+
+	/* Two revolutions: the first one clears the accessed state of every
+	 * page it skips, so the second one is bound to find a victim if
+	 * there is any evictable page.
+	 */
+	for (size_t i = 0; i < 2 * Z_NUM_PAGE_FRAMES; i++) {
+#ifdef CONFIG_EVICTION_CLOCK_PREFER_CLEAN
+		if ((dirty_pf != NULL) &&
+		    (i - dirty_at > CONFIG_EVICTION_CLOCK_CLEAN_WINDOW)) {
+			/* Nothing clean close enough */
+			break;
+		}
+#endif
+		pf = clock_advance();
+
+		if (!z_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		/* Returns the state prior to clearing accessed */
+		flags = arch_page_info_get(pf->addr, NULL, true);
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if ((flags & ARCH_DATA_PAGE_ACCESSED) != 0U) {
+			/* Second chance */
+			continue;
+		}
+
+		if ((flags & ARCH_DATA_PAGE_DIRTY) == 0U) {
+			*dirty_ptr = false;
+			return pf;
+		}
+
+		if (!IS_ENABLED(CONFIG_EVICTION_CLOCK_PREFER_CLEAN)) {
+			*dirty_ptr = true;
+			return pf;
+		}
+
+		if (dirty_pf == NULL) {
+			dirty_pf = pf;
+			dirty_at = i;
+		}
+	}
+
+	/* Shouldn't ever happen unless every page is pinned */
+	__ASSERT(dirty_pf != NULL, "no page to evict");
+
+	*dirty_ptr = true;
+
+	return dirty_pf;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+	clock_hand = 0;
+}
@@ -79,9 +79,18 @@ int flash_img_init_id(struct flash_img_context *ctx, uint8_t area_id)
 
 	flash_dev = flash_area_get_device(ctx->flash_area);
 
-	return stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
+	rc = stream_flash_init(&ctx->stream, flash_dev, ctx->buf,
 			CONFIG_IMG_BLOCK_BUF_SIZE, ctx->flash_area->fa_off,
 			ctx->flash_area->fa_size, NULL);
+
+#ifdef CONFIG_IMG_ERASE_AHEAD_PAGES
+	if (rc == 0) {
+		rc = stream_flash_erase_ahead(&ctx->stream,
+					      CONFIG_IMG_ERASE_AHEAD_PAGES);
+	}
+#endif
+
+	return rc;
 }
 
 int flash_img_init(struct flash_img_context *ctx)
@@ -4,7 +4,9 @@
  * SPDX-License-Identifier: Apache-2.0
  *
  * Emulator for the Boche BMI160 accelerometer / gyro. This supports basic
- * init and reading of canned samples. It supports both I2C and SPI buses.
+ * init and reading of canned samples, also through the FIFO in headerless
+ * mode, which fills at the configured ODR. It supports both I2C and SPI
+ * buses.
  */
 
 #define DT_DRV_COMPAT bosch_bmi160
@@ -37,6 +39,10 @@ struct bmi160_emul_data {
 	uint8_t pmu_status;
 	/** Current register to read (address) */
 	uint32_t cur_reg;
+	/** Frames in the FIFO */
+	uint32_t fifo_frames;
+	/** Uptime up to which the FIFO was filled, in nanoseconds */
+	uint64_t fifo_time_ns;
 };
 
 /** Static configuration for the emulator */
@@ -77,6 +83,67 @@ static void sample_read(struct bmi160_emul_data *data, union bmi160_sample *buf)
 	memcpy(buf->raw, raw_data, ARRAY_SIZE(raw_data));
 }
 
+/* Add the frames taken since the last update to the FIFO */
+static void fifo_update(struct bmi160_emul_data *data)
+{
+	const struct bmi160_emul_cfg *cfg = data->cfg;
+	uint64_t now = k_ticks_to_ns_floor64(k_uptime_ticks());
+	uint8_t odr = cfg->reg[BMI160_FIFO_ODR_REG] & BMI160_ACC_CONF_ODR_MASK;
+	uint64_t period, frames;
+
+	if (!(cfg->reg[BMI160_REG_FIFO_CONFIG1] & BMI160_FIFO_FRAME_EN) ||
+	    odr < BMI160_ODR_25_32 || odr > BMI160_ODR_3200) {
+		data->fifo_time_ns = now;
+		return;
+	}
+
+	if (odr >= BMI160_ODR_100) {
+		period = 10000000U >> (odr - BMI160_ODR_100);
+	} else {
+		period = 10000000U << (BMI160_ODR_100 - odr);
+	}
+
+	frames = (now - data->fifo_time_ns) / period;
+	data->fifo_time_ns += frames * period;
+
+	/* Older frames are lost when the FIFO is full */
+	data->fifo_frames = MIN(data->fifo_frames + frames,
+				BMI160_FIFO_SIZE / BMI160_SAMPLE_SIZE);
+}
+
+static void fifo_reset(struct bmi160_emul_data *data)
+{
+	data->fifo_frames = 0;
+	data->fifo_time_ns = k_ticks_to_ns_floor64(k_uptime_ticks());
+}
+
+/* Handle the reads of the FIFO registers, return false for the others */
+static bool fifo_read(struct bmi160_emul_data *data, int regn, uint8_t *buf,
+		      unsigned int len)
+{
+	switch (regn) {
+	case BMI160_REG_FIFO_LENGTH0:
+		if (len != 2) {
+			return false;
+		}
+		fifo_update(data);
+		sys_put_le16(data->fifo_frames * BMI160_SAMPLE_SIZE, buf);
+		return true;
+	case BMI160_REG_FIFO_DATA:
+		fifo_update(data);
+		for (; len >= BMI160_SAMPLE_SIZE && data->fifo_frames;
+		     len -= BMI160_SAMPLE_SIZE, buf += BMI160_SAMPLE_SIZE) {
+			sample_read(data, (union bmi160_sample *)buf);
+			data->fifo_frames--;
+		}
+		/* Reading past the end of the FIFO returns no data */
+		memset(buf, 0, len);
+		return true;
+	default:
+		return false;
+	}
+}
+
 static void reg_write(const struct bmi160_emul_cfg *cfg, int regn, int val)
 {
 	struct bmi160_emul_data *data = cfg->data;
@@ -96,11 +163,19 @@ static void reg_write(const struct bmi160_emul_cfg *cfg, int regn, int val)
 	case BMI160_REG_GYR_RANGE:
 		LOG_INF("   * gyr range");
 		break;
+	case BMI160_REG_FIFO_CONFIG1:
+		LOG_INF("   * fifo config");
+		fifo_reset(data);
+		break;
 	case BMI160_REG_CMD:
 		switch (val) {
 		case BMI160_CMD_SOFT_RESET:
 			LOG_INF("   * soft reset");
 			break;
+		case BMI160_CMD_FIFO_FLUSH:
+			LOG_INF("   * fifo flush");
+			fifo_reset(data);
+			break;
 		default:
 			if ((val & BMI160_CMD_PMU_BIT) == BMI160_CMD_PMU_BIT) {
 				int which = (val & BMI160_CMD_PMU_MASK) >>
@@ -210,6 +285,11 @@ static int bmi160_emul_io_spi(struct spi_emul *emul,
 				LOG_ERR("Cannot read without rxd");
 				return -EPERM;
 			}
+			if ((regn & BMI160_REG_READ) &&
+			    fifo_read(data, regn & BMI160_REG_MASK, rxd->buf,
+				      rxd->len)) {
+				break;
+			}
 			switch (txd->len) {
 			case 1:
 				if (regn & BMI160_REG_READ) {
@@ -276,6 +356,10 @@ static int bmi160_emul_transfer_i2c(struct i2c_emul *emul, struct i2c_msg *msgs,
 		/* Now process the 'read' part of the message */
 		msgs++;
 		if (msgs->flags & I2C_MSG_READ) {
+			if (fifo_read(data, data->cur_reg, msgs->buf,
+				      msgs->len)) {
+				break;
+			}
 			switch (msgs->len) {
 			case 1:
 				val = reg_read(cfg, data->cur_reg);
@@ -5,12 +5,29 @@
  */
 
 #include <zephyr.h>
+#include <init.h>
 #include "net/buf.h"
 #include "mgmt/mgmt.h"
 #include "mgmt/mcumgr/buf.h"
 #include "smp/smp.h"
 #include "mgmt/mcumgr/smp.h"
 
+/* Transports whose windows share the buffer pool */
+#define SMP_WINDOW_TRANSPORTS					\
+	(IS_ENABLED(CONFIG_MCUMGR_SMP_UDP_IPV4) +		\
+	 IS_ENABLED(CONFIG_MCUMGR_SMP_UDP_IPV6) +		\
+	 (IS_ENABLED(CONFIG_MCUMGR_SMP_BT) && CONFIG_MCUMGR_SMP_WINDOW > 1))
+
+BUILD_ASSERT(CONFIG_MCUMGR_BUF_COUNT >
+	     SMP_WINDOW_TRANSPORTS * CONFIG_MCUMGR_SMP_WINDOW,
+	     "A buffer is needed for the response of the window requests");
+
+#ifdef CONFIG_MCUMGR_SMP_WORKQUEUE
+static K_KERNEL_STACK_DEFINE(smp_work_queue_stack,
+			     CONFIG_MCUMGR_SMP_WORKQUEUE_STACK_SIZE);
+static struct k_work_q smp_work_queue;
+#endif
+
 static mgmt_alloc_rsp_fn zephyr_smp_alloc_rsp;
 static mgmt_trim_front_fn zephyr_smp_trim_front;
 static mgmt_reset_buf_fn zephyr_smp_reset_buf;
@@ -263,7 +280,98 @@ zephyr_smp_process_packet(struct zephyr_smp_transport *zst,
 }
 
 /**
- * Processes all received SNP request packets.
+ * Processes a request and gives its room in the window back.  Transports not
+ * allocating requests with zephyr_smp_rx_buf_alloc() never take from the
+ * window, its count then stays at the limit.
+ */
+static void
+zephyr_smp_process_req(struct zephyr_smp_transport *zst, struct net_buf *nb)
+{
+	zephyr_smp_process_packet(zst, nb);
+	k_sem_give(&zst->zst_window);
+}
+
+#ifdef CONFIG_MCUMGR_SMP_REORDER
+/**
+ * Position of a request in the processing order: distance of its sequence
+ * number from the expected one, wrapping around.
+ */
+static uint8_t
+zephyr_smp_seq_key(const struct zephyr_smp_transport *zst,
+		   const struct net_buf *nb)
+{
+	const struct mgmt_hdr *hdr;
+
+	if (nb->len < sizeof(*hdr)) {
+		return UINT8_MAX;
+	}
+
+	hdr = (const struct mgmt_hdr *)nb->data;
+
+	return hdr->nh_seq - zst->zst_seq;
+}
+
+/**
+ * Inserts a request in an array sorted by processing order, after the ones
+ * with the same key.
+ */
+static void
+zephyr_smp_insert_req(const struct zephyr_smp_transport *zst,
+		      struct net_buf **reqs, int count, struct net_buf *nb)
+{
+	uint8_t key;
+	int i;
+
+	key = zephyr_smp_seq_key(zst, nb);
+
+	for (i = count; i > 0; i--) {
+		if (zephyr_smp_seq_key(zst, reqs[i - 1]) <= key) {
+			break;
+		}
+		reqs[i] = reqs[i - 1];
+	}
+
+	reqs[i] = nb;
+}
+
+/**
+ * Processes all received SMP request packets, the ones waiting together in
+ * sequence number order.
+ */
+static void
+zephyr_smp_handle_reqs(struct k_work *work)
+{
+	struct net_buf *reqs[CONFIG_MCUMGR_SMP_WINDOW];
+	const struct mgmt_hdr *hdr;
+	struct zephyr_smp_transport *zst;
+	struct net_buf *nb;
+	int count;
+	int i;
+
+	zst = (void *)work;
+
+	do {
+		count = 0;
+		while (count < ARRAY_SIZE(reqs) &&
+		       (nb = net_buf_get(&zst->zst_fifo, K_NO_WAIT)) != NULL) {
+			zephyr_smp_insert_req(zst, reqs, count, nb);
+			count++;
+		}
+
+		for (i = 0; i < count; i++) {
+			nb = reqs[i];
+			if (nb->len >= sizeof(*hdr)) {
+				hdr = (const struct mgmt_hdr *)nb->data;
+				zst->zst_seq = hdr->nh_seq + 1;
+			}
+
+			zephyr_smp_process_req(zst, nb);
+		}
+	} while (count > 0);
+}
+#else
+/**
+ * Processes all received SMP request packets.
  */
 static void
 zephyr_smp_handle_reqs(struct k_work *work)
@@ -274,9 +382,10 @@ zephyr_smp_handle_reqs(struct k_work *work)
 	zst = (void *)work;
 
 	while ((nb = net_buf_get(&zst->zst_fifo, K_NO_WAIT)) != NULL) {
-		zephyr_smp_process_packet(zst, nb);
+		zephyr_smp_process_req(zst, nb);
 	}
 }
+#endif /* CONFIG_MCUMGR_SMP_REORDER */
 
 void
 zephyr_smp_transport_init(struct zephyr_smp_transport *zst,
@@ -294,11 +403,56 @@ zephyr_smp_transport_init(struct zephyr_smp_transport *zst,
 
 	k_work_init(&zst->zst_work, zephyr_smp_handle_reqs);
 	k_fifo_init(&zst->zst_fifo);
+	k_sem_init(&zst->zst_window, CONFIG_MCUMGR_SMP_WINDOW,
+		   CONFIG_MCUMGR_SMP_WINDOW);
+}
+
+struct net_buf *
+zephyr_smp_rx_buf_alloc(struct zephyr_smp_transport *zst,
+			k_timeout_t timeout)
+{
+	struct net_buf *nb;
+
+	if (k_sem_take(&zst->zst_window, timeout) != 0) {
+		return NULL;
+	}
+
+	nb = mcumgr_buf_alloc();
+	if (nb == NULL) {
+		k_sem_give(&zst->zst_window);
+	}
+
+	return nb;
 }
 
 void
 zephyr_smp_rx_req(struct zephyr_smp_transport *zst, struct net_buf *nb)
 {
 	net_buf_put(&zst->zst_fifo, nb);
+#ifdef CONFIG_MCUMGR_SMP_WORKQUEUE
+	k_work_submit_to_queue(&smp_work_queue, &zst->zst_work);
+#else
 	k_work_submit(&zst->zst_work);
+#endif
+}
+
+#ifdef CONFIG_MCUMGR_SMP_WORKQUEUE
+static int
+zephyr_smp_work_queue_init(const struct device *dev)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "mcumgr_smp",
+	};
+
+	ARG_UNUSED(dev);
+
+	k_work_queue_start(&smp_work_queue, smp_work_queue_stack,
+			   K_KERNEL_STACK_SIZEOF(smp_work_queue_stack),
+			   CONFIG_MCUMGR_SMP_WORKQUEUE_THREAD_PRIO, &cfg);
+
+	return 0;
 }
+
+SYS_INIT(zephyr_smp_work_queue_init, POST_KERNEL,
+	 CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+#endif /* CONFIG_MCUMGR_SMP_WORKQUEUE */
@@ -54,7 +54,18 @@ static ssize_t smp_bt_chr_write(struct bt_conn *conn,
 	struct smp_bt_user_data *ud;
 	struct net_buf *nb;
 
-	nb = mcumgr_buf_alloc();
+	/* Requests are written without response, they would be lost while a
+	 * window of one is full. Only the buffer pool limits them then.
+	 */
+	if (CONFIG_MCUMGR_SMP_WINDOW > 1) {
+		nb = zephyr_smp_rx_buf_alloc(&smp_bt_transport, K_NO_WAIT);
+	} else {
+		nb = mcumgr_buf_alloc();
+	}
+	if (nb == NULL) {
+		return BT_GATT_ERR(BT_ATT_ERR_INSUFFICIENT_RESOURCES);
+	}
+
 	net_buf_add_mem(nb, buf, len);
 
 	ud = net_buf_user_data(nb);
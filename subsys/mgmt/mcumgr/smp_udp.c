@@ -119,8 +119,17 @@ static void smp_udp_receive_thread(void *p1, void *p2, void *p3)
 			struct sockaddr *ud;
 			struct net_buf *nb;
 
+			/* Wait for room in the window, the next datagrams
+			 * are kept by the socket meanwhile.
+			 */
+			nb = zephyr_smp_rx_buf_alloc(&conf->smp_transport,
+						     K_FOREVER);
+			if (nb == NULL) {
+				LOG_WRN("Dropped request (%s)", conf->proto);
+				continue;
+			}
+
 			/* store sender address in user data for reply */
-			nb = mcumgr_buf_alloc();
 			net_buf_add_mem(nb, conf->recv_buffer, len);
 			ud = net_buf_user_data(nb);
 			net_ipaddr_copy(ud, &addr);
@@ -214,6 +214,75 @@ static int cmd_kernel_stacks(const struct shell *shell,
 }
 #endif
 
+#if defined(CONFIG_SCHED_THREAD_STATS)
+static int cmd_kernel_sched(const struct shell *shell,
+			    size_t argc, char **argv)
+{
+	struct k_sched_runq_stats runq;
+	struct k_cpu_sched_stats cpu;
+	uint64_t total;
+
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	(void)k_sched_runq_stats_get(&runq);
+	shell_print(shell, "Run queue: depth %u, max depth %u",
+		    runq.depth, runq.max_depth);
+
+	for (int i = 0; i < CONFIG_MP_NUM_CPUS; i++) {
+		(void)k_cpu_sched_stats_get(i, &cpu);
+		total = cpu.idle_cycles + cpu.busy_cycles;
+
+		shell_print(shell, "CPU %d: switches %u, utilization %u %%",
+			    i, cpu.switches,
+			    (total == 0U) ? 0U :
+			    (unsigned int)((cpu.busy_cycles * 100U) / total));
+	}
+
+	return 0;
+}
+
+#if defined(CONFIG_THREAD_MONITOR)
+static void shell_latency_dump(const struct k_thread *cthread,
+			       void *user_data)
+{
+	struct k_thread *thread = (struct k_thread *)cthread;
+	const struct shell *shell = (const struct shell *)user_data;
+	struct k_thread_sched_stats stats;
+	const char *tname;
+
+	if (k_thread_sched_stats_get(thread, &stats) != 0) {
+		return;
+	}
+
+	tname = k_thread_name_get(thread);
+
+	shell_print(shell, "%p %-10s switches %u, ready %u ms, "
+		    "max wakeup latency %u us",
+		    thread, tname ? tname : "NA", stats.switches,
+		    (uint32_t)k_cyc_to_ms_floor64(stats.ready_cycles),
+		    k_cyc_to_us_ceil32(stats.max_wakeup_latency));
+
+	shell_fprintf(shell, SHELL_NORMAL, "\twakeup latency histogram:");
+	for (int i = 0; i < CONFIG_SCHED_THREAD_STATS_HIST_BUCKETS; i++) {
+		shell_fprintf(shell, SHELL_NORMAL, " %u", stats.wakeup_hist[i]);
+	}
+	shell_fprintf(shell, SHELL_NORMAL, "\n");
+}
+
+static int cmd_kernel_latency(const struct shell *shell,
+			      size_t argc, char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	shell_print(shell, "Histogram buckets: <1 us, then up to 2^n us");
+	k_thread_foreach(shell_latency_dump, (void *)shell);
+	return 0;
+}
+#endif
+#endif
+
 #if defined(CONFIG_REBOOT)
 static int cmd_kernel_reboot_warm(const struct shell *shell,
 				  size_t argc, char **argv)
@@ -248,9 +317,17 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel_reboot,
 
 SHELL_STATIC_SUBCMD_SET_CREATE(sub_kernel,
 	SHELL_CMD(cycles, NULL, "Kernel cycles.", cmd_kernel_cycles),
+#if defined(CONFIG_SCHED_THREAD_STATS) && defined(CONFIG_THREAD_MONITOR)
+	SHELL_CMD(latency, NULL, "Threads wakeup latency.",
+		  cmd_kernel_latency),
+#endif
 #if defined(CONFIG_REBOOT)
 	SHELL_CMD(reboot, &sub_kernel_reboot, "Reboot.", NULL),
 #endif
+#if defined(CONFIG_SCHED_THREAD_STATS)
+	SHELL_CMD(sched, NULL, "Run queue and CPU statistics.",
+		  cmd_kernel_sched),
+#endif
 #if defined(CONFIG_INIT_STACKS) && defined(CONFIG_THREAD_STACK_INFO) && \
 		defined(CONFIG_THREAD_MONITOR)
 	SHELL_CMD(stacks, NULL, "List threads stack usage.", cmd_kernel_stacks),
@@ -7,6 +7,7 @@
 #include <ctype.h>
 #include <stdlib.h>
 #include <sys/atomic.h>
+#include <sys/byteorder.h>
 #include <shell/shell.h>
 #if defined(CONFIG_SHELL_BACKEND_DUMMY)
 #include <shell/shell_dummy.h>
@@ -324,6 +325,12 @@ static void find_completion_candidates(const struct shell *shell,
 	*longest = 0U;
 	*cnt = 0;
 
+	/* Sorted root commands starting with the same string are adjacent */
+	if (cmd == NULL) {
+		idx = z_shell_root_cmd_lower_bound(incompl_cmd,
+						   incompl_cmd_len);
+	}
+
 	while ((candidate = z_shell_cmd_get(cmd, idx, &dloc)) != NULL) {
 		bool is_candidate;
 		is_candidate = is_completion_candidate(candidate->syntax,
@@ -334,6 +341,8 @@ static void find_completion_candidates(const struct shell *shell,
 				*first_idx = idx;
 			}
 			(*cnt)++;
+		} else if ((cmd == NULL) && z_shell_root_cmds_sorted()) {
+			break;
 		}
 
 		idx++;
@@ -543,11 +552,18 @@ static int exec_cmd(const struct shell *shell, size_t argc, const char **argv,
 		/* Unlock thread mutex in case command would like to borrow
 		 * shell context to other thread to avoid mutex deadlock.
 		 */
+		if (IS_ENABLED(CONFIG_SHELL_OUTPUT_BATCH)) {
+			shell->fprintf_ctx->ctrl_blk->autoflush = false;
+		}
 		k_mutex_unlock(&shell->ctx->wr_mtx);
 		ret_val = shell->ctx->active_cmd.handler(shell, argc,
 							 (char **)argv);
 		/* Bring back mutex to shell thread. */
 		k_mutex_lock(&shell->ctx->wr_mtx, K_FOREVER);
+		if (IS_ENABLED(CONFIG_SHELL_OUTPUT_BATCH)) {
+			z_transport_buffer_flush(shell);
+			shell->fprintf_ctx->ctrl_blk->autoflush = true;
+		}
 		z_flag_cmd_ctx_set(shell, false);
 	}
 
@@ -928,12 +944,137 @@ static inline int ascii_filter(const char data)
 	return (uint8_t) data > SHELL_ASCII_MAX_CHAR ? -EINVAL : 0;
 }
 
+#if defined CONFIG_SHELL_BINARY_MODE
+/* Start byte and 16 bit payload length */
+#define BINARY_HDR_LEN 3
+
+static inline bool binary_mode_get(const struct shell *shell)
+{
+	return shell->ctx->binary.handler != NULL;
+}
+
+static void binary_frame_write(const struct shell *shell, const void *data,
+			       uint16_t len)
+{
+	uint8_t hdr[BINARY_HDR_LEN] = { SHELL_BINARY_FRAME_START };
+
+	sys_put_le16(len, &hdr[1]);
+	z_shell_write(shell, hdr, sizeof(hdr));
+	if (len) {
+		z_shell_write(shell, data, len);
+	}
+}
+
+static void binary_mode_ack(const struct shell *shell)
+{
+	uint8_t size[sizeof(uint16_t)];
+
+	sys_put_le16(CONFIG_SHELL_BINARY_FRAME_SIZE, size);
+	shell->ctx->binary.hdr_len = 0;
+	shell->ctx->binary.active = true;
+	binary_frame_write(shell, size, sizeof(size));
+}
+
+static void binary_mode_exit(const struct shell *shell)
+{
+	shell->ctx->binary.active = false;
+	shell->ctx->binary.handler = NULL;
+
+	if (IS_ENABLED(CONFIG_SHELL_LOG_BACKEND)) {
+		/* Print the log messages held while in binary mode. */
+		k_poll_signal_raise(&shell->ctx->signals[SHELL_SIGNAL_LOG_MSG],
+				    0);
+	}
+
+	state_set(shell, SHELL_STATE_ACTIVE);
+}
+
+/* Collects frames, payloads are read in bulk straight into the frame
+ * buffer. Returns false once the shell is back in text mode.
+ */
+static bool binary_collect(const struct shell *shell)
+{
+	struct shell_binary_ctx *bin = &shell->ctx->binary;
+	size_t count = 0;
+	uint8_t data;
+	int ret;
+
+	while (true) {
+		if (bin->hdr_len < BINARY_HDR_LEN) {
+			(void)shell->iface->api->read(shell->iface, &data,
+						      sizeof(data), &count);
+			if (count == 0) {
+				return true;
+			}
+
+			if (bin->hdr_len == 0) {
+				/* Skip anything outside of frames, such as
+				 * the end of the command line.
+				 */
+				if (data != SHELL_BINARY_FRAME_START) {
+					continue;
+				}
+				bin->len = 0;
+				bin->cnt = 0;
+			} else {
+				bin->len |= data << (8 * (bin->hdr_len - 1));
+			}
+
+			bin->hdr_len++;
+			continue;
+		}
+
+		if (bin->cnt < bin->len) {
+			/* Oversized frames wrap around and are dropped. */
+			size_t off = bin->cnt % sizeof(bin->buf);
+			size_t len = MIN(bin->len - bin->cnt,
+					 sizeof(bin->buf) - off);
+
+			(void)shell->iface->api->read(shell->iface,
+						      &bin->buf[off], len,
+						      &count);
+			if (count == 0) {
+				return true;
+			}
+
+			bin->cnt += count;
+			if (bin->cnt < bin->len) {
+				continue;
+			}
+		}
+
+		bin->hdr_len = 0;
+		if (bin->len > sizeof(bin->buf)) {
+			continue;
+		}
+
+		ret = bin->handler(shell, bin->len ? bin->buf : NULL,
+				   bin->len, bin->user_data);
+		if ((ret != 0) || (bin->len == 0)) {
+			binary_mode_exit(shell);
+			return false;
+		}
+	}
+}
+#endif /* CONFIG_SHELL_BINARY_MODE */
+
 static void state_collect(const struct shell *shell)
 {
 	size_t count = 0;
 	char data;
 
 	while (true) {
+#if defined CONFIG_SHELL_BINARY_MODE
+		if (binary_mode_get(shell)) {
+			if (!shell->ctx->binary.active) {
+				binary_mode_ack(shell);
+			}
+
+			if (binary_collect(shell)) {
+				return;
+			}
+		}
+#endif
 		(void)shell->iface->api->read(shell->iface, &data,
 					      sizeof(data), &count);
 		if (count == 0) {
@@ -953,6 +1094,15 @@ static void state_collect(const struct shell *shell)
 				} else {
 					/* Command execution */
 					(void)execute(shell);
+#if defined CONFIG_SHELL_BINARY_MODE
+					/* The command switched to binary mode,
+					 * no prompt until back in text mode.
+					 */
+					if (binary_mode_get(shell)) {
+						cmd_buffer_clear(shell);
+						continue;
+					}
+#endif
 				}
 				/* Function responsible for printing prompt
 				 * on received NL.
@@ -1116,6 +1266,13 @@ static void shell_log_process(const struct shell *shell)
 	int signaled = 0;
 	int result;
 
+#if defined CONFIG_SHELL_BINARY_MODE
+	/* Held in the queue until back in text mode. */
+	if (shell->ctx->binary.active) {
+		return;
+	}
+#endif
+
 	do {
 		if (!IS_ENABLED(CONFIG_LOG_IMMEDIATE)) {
 			z_shell_cmd_line_erase(shell);
@@ -1437,6 +1594,16 @@ void shell_vfprintf(const struct shell *shell, enum shell_vt100_color color,
 	}
 
 	k_mutex_lock(&shell->ctx->wr_mtx, K_FOREVER);
+
+#if defined CONFIG_SHELL_BINARY_MODE
+	/* Text would corrupt the frames. The mode changes under wr_mtx. */
+	if (shell->ctx->binary.active) {
+		z_flag_print_noinit_set(shell, true);
+		k_mutex_unlock(&shell->ctx->wr_mtx);
+		return;
+	}
+#endif
+
 	if (!z_flag_cmd_ctx_get(shell)) {
 		z_shell_cmd_line_erase(shell);
 	}
@@ -1444,7 +1611,10 @@ void shell_vfprintf(const struct shell *shell, enum shell_vt100_color color,
 	if (!z_flag_cmd_ctx_get(shell)) {
 		z_shell_print_prompt_and_cmd(shell);
 	}
-	z_transport_buffer_flush(shell);
+	/* Output of a command is flushed when it returns if batched */
+	if (shell->fprintf_ctx->ctrl_blk->autoflush) {
+		z_transport_buffer_flush(shell);
+	}
 	k_mutex_unlock(&shell->ctx->wr_mtx);
 }
 
@@ -1572,6 +1742,51 @@ int shell_execute_cmd(const struct shell *shell, const char *cmd)
 	return ret_val;
 }
 
+#if defined CONFIG_SHELL_BINARY_MODE
+int shell_binary_mode_enter(const struct shell *shell,
+			    shell_binary_handler_t handler, void *user_data)
+{
+	__ASSERT_NO_MSG(shell && shell->ctx && handler);
+
+	if (!z_flag_cmd_ctx_get(shell)) {
+		return -EINVAL;
+	}
+
+	if (binary_mode_get(shell)) {
+		return -EBUSY;
+	}
+
+	shell->ctx->binary.user_data = user_data;
+	shell->ctx->binary.handler = handler;
+
+	return 0;
+}
+
+int shell_binary_write(const struct shell *shell, const void *data,
+		       size_t len)
+{
+	__ASSERT_NO_MSG(shell && shell->ctx);
+	__ASSERT_NO_MSG(data || (len == 0));
+
+	if (len > UINT16_MAX) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&shell->ctx->wr_mtx, K_FOREVER);
+
+	if (!shell->ctx->binary.active) {
+		k_mutex_unlock(&shell->ctx->wr_mtx);
+		return -ENOTSUP;
+	}
+
+	binary_frame_write(shell, data, len);
+
+	k_mutex_unlock(&shell->ctx->wr_mtx);
+
+	return 0;
+}
+#endif /* CONFIG_SHELL_BINARY_MODE */
+
 int shell_insert_mode_set(const struct shell *shell, bool val)
 {
 	if (shell == NULL) {
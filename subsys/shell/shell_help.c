@@ -127,6 +127,7 @@ static void help_item_print(const struct shell *shell, const char *item_name,
 
 		z_shell_fprintf(shell, SHELL_NORMAL, "%s%s", tabulator,
 				item_name);
+		z_transport_buffer_flush(shell);
 		for (uint16_t i = 0; i < tmp; i++) {
 			z_shell_write(shell, &space, 1);
 		}
@@ -155,6 +155,7 @@ static void uart_irq_init(const struct shell_uart *sh_uart)
 static void timer_handler(struct k_timer *timer)
 {
 	uint8_t c;
+	bool new_data = false;
 	const struct shell_uart *sh_uart = k_timer_user_data_get(timer);
 
 	while (uart_poll_in(sh_uart->ctrl_blk->dev, &c) == 0) {
@@ -162,6 +163,11 @@ static void timer_handler(struct k_timer *timer)
 			/* ring buffer full. */
 			LOG_WRN("RX ring buffer full.");
 		}
+		new_data = true;
+	}
+
+	/* Signal once, the shell reads everything that was received. */
+	if (new_data) {
 		sh_uart->ctrl_blk->handler(SHELL_TRANSPORT_EVT_RX_RDY,
 					   sh_uart->ctrl_blk->context);
 	}
@@ -228,17 +228,76 @@ static inline uint32_t shell_root_cmd_count(void)
 				sizeof(struct shell_cmd_entry);
 }
 
+/* Root commands are placed in sections named after them, which the linker
+ * sorts. The order is checked once before binary searching them, as
+ * linkers not sorting the sections would break lookups.
+ */
+bool z_shell_root_cmds_sorted(void)
+{
+	static int8_t sorted;
+
+	if (sorted == 0) {
+		const size_t cmd_count = shell_root_cmd_count();
+		int8_t order = 1;
+
+		for (size_t idx = 1; idx < cmd_count; idx++) {
+			const struct shell_cmd_entry *prev =
+				shell_root_cmd_get(idx - 1);
+			const struct shell_cmd_entry *cmd =
+				shell_root_cmd_get(idx);
+
+			if (strcmp(prev->u.entry->syntax,
+				   cmd->u.entry->syntax) >= 0) {
+				order = -1;
+				break;
+			}
+		}
+
+		sorted = order;
+	}
+
+	return sorted > 0;
+}
+
+size_t z_shell_root_cmd_lower_bound(const char *str, size_t len)
+{
+	size_t lo = 0;
+	size_t hi = shell_root_cmd_count();
+
+	if (!z_shell_root_cmds_sorted()) {
+		return 0;
+	}
+
+	while (lo < hi) {
+		size_t mid = lo + (hi - lo) / 2;
+
+		if (strncmp(shell_root_cmd_get(mid)->u.entry->syntax, str,
+			    len) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
 /* Function returning pointer to parent command matching requested syntax. */
 static const struct shell_static_entry *root_cmd_find(const char *syntax)
 {
 	const size_t cmd_count = shell_root_cmd_count();
 	const struct shell_cmd_entry *cmd;
+	size_t cmd_idx = z_shell_root_cmd_lower_bound(syntax, SIZE_MAX);
 
-	for (size_t cmd_idx = 0; cmd_idx < cmd_count; ++cmd_idx) {
+	for (; cmd_idx < cmd_count; ++cmd_idx) {
 		cmd = shell_root_cmd_get(cmd_idx);
 		if (strcmp(syntax, cmd->u.entry->syntax) == 0) {
 			return cmd->u.entry;
 		}
+
+		if (z_shell_root_cmds_sorted()) {
+			break;
+		}
 	}
 
 	return NULL;
@@ -302,6 +361,8 @@ const struct shell_static_entry *z_shell_find_cmd(
 	if (parent) {
 		memcpy(&parent_cpy, parent, sizeof(struct shell_static_entry));
 		parent = &parent_cpy;
+	} else {
+		return root_cmd_find(cmd_str);
 	}
 
 	while ((entry = z_shell_cmd_get(parent, idx++, dloc)) != NULL) {
@@ -53,6 +53,22 @@ const struct shell_static_entry *z_shell_cmd_get(
 					size_t idx,
 					struct shell_static_entry *dloc);
 
+/* @internal @brief Check if root commands are sorted by syntax.
+ *
+ * @return True if root commands can be binary searched.
+ */
+bool z_shell_root_cmds_sorted(void);
+
+/* @internal @brief Find the first root command not lower than a string.
+ *
+ * @param str		String compared to the commands syntax.
+ * @param len		Number of characters compared, SIZE_MAX for all.
+ *
+ * @return		Index of the command, 0 if root commands are not
+ *			sorted.
+ */
+size_t z_shell_root_cmd_lower_bound(const char *str, size_t len);
+
 const struct shell_static_entry *z_shell_find_cmd(
 					const struct shell_static_entry *parent,
 					const char *cmd_str,
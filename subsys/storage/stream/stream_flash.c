@@ -16,6 +16,41 @@ LOG_MODULE_REGISTER(LOG_MODULE_NAME, CONFIG_STREAM_FLASH_LOG_LEVEL);
 
 #include <storage/stream_flash.h>
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+static K_KERNEL_STACK_DEFINE(erase_ahead_stack,
+			     CONFIG_STREAM_FLASH_ERASE_AHEAD_STACK_SIZE);
+static struct k_work_q erase_ahead_workq;
+
+/*
+ * The writes only need to lock the context while pages are erased ahead.
+ * Erase ahead is enabled and disabled by the writer, the context is not
+ * used concurrently otherwise.
+ */
+static inline void ctx_lock(struct stream_flash_ctx *ctx)
+{
+	if (ctx->erase_ahead) {
+		k_mutex_lock(&ctx->lock, K_FOREVER);
+	}
+}
+
+static inline void ctx_unlock(struct stream_flash_ctx *ctx)
+{
+	if (ctx->erase_ahead) {
+		k_mutex_unlock(&ctx->lock);
+	}
+}
+#else
+static inline void ctx_lock(struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+
+static inline void ctx_unlock(struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+#endif /* CONFIG_STREAM_FLASH_ERASE_AHEAD */
+
 #ifdef CONFIG_STREAM_FLASH_PROGRESS
 #include <settings/settings.h>
 
@@ -61,6 +96,10 @@ static int settings_direct_loader(const char *key, size_t len,
 				return rc;
 			}
 			ctx->last_erased_page_start_offset = page.start_offset;
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+			ctx->erased_start = page.start_offset;
+			ctx->erased_end = page.start_offset + page.size;
+#endif
 		} else {
 			ctx->last_erased_page_start_offset = -1;
 		}
@@ -74,6 +113,77 @@ static int settings_direct_loader(const char *key, size_t len,
 
 #ifdef CONFIG_STREAM_FLASH_ERASE
 
+/*
+ * Erase a page unless it is known to be erased. Pages erased while streaming
+ * extend the erased range the writes progress in, pages erased ahead of the
+ * writes are at its end.
+ */
+static int erase_page(struct stream_flash_ctx *ctx,
+		      const struct flash_pages_info *page, bool stream)
+{
+	int rc;
+
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	if (stream && page->start_offset >= ctx->erased_start &&
+	    page->start_offset < ctx->erased_end) {
+		return 0;
+	}
+#endif
+
+	if (ctx->last_erased_page_start_offset != page->start_offset) {
+		LOG_DBG("Erasing page at offset 0x%08lx",
+			(long)page->start_offset);
+
+		rc = flash_erase(ctx->fdev, page->start_offset, page->size);
+
+		if (rc != 0) {
+			LOG_ERR("Error %d while erasing page", rc);
+			return rc;
+		}
+
+		ctx->last_erased_page_start_offset = page->start_offset;
+	}
+
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	/* Also when erased by stream_flash_erase_page(), or erasing ahead
+	 * would not get past that page
+	 */
+	if (stream) {
+		if (page->start_offset != ctx->erased_end) {
+			ctx->erased_start = page->start_offset;
+		}
+		ctx->erased_end = page->start_offset + page->size;
+	}
+#endif
+
+	return 0;
+}
+
+/* Erase the pages the range is in */
+static int erase_range(struct stream_flash_ctx *ctx, off_t start, size_t len)
+{
+	struct flash_pages_info page;
+	off_t off = start;
+	int rc;
+
+	while (off < start + (off_t)len) {
+		rc = flash_get_page_info_by_offs(ctx->fdev, off, &page);
+		if (rc != 0) {
+			LOG_ERR("Error %d while getting page info", rc);
+			return rc;
+		}
+
+		rc = erase_page(ctx, &page, true);
+		if (rc != 0) {
+			return rc;
+		}
+
+		off = page.start_offset + page.size;
+	}
+
+	return 0;
+}
+
 int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 {
 	int rc;
@@ -85,26 +195,121 @@ int stream_flash_erase_page(struct stream_flash_ctx *ctx, off_t off)
 		return rc;
 	}
 
-	if (ctx->last_erased_page_start_offset == page.start_offset) {
-		return 0;
+	ctx_lock(ctx);
+	rc = erase_page(ctx, &page, false);
+	ctx_unlock(ctx);
+
+	return rc;
+}
+
+#endif /* CONFIG_STREAM_FLASH_ERASE */
+
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+
+static void erase_ahead_work(struct k_work *work)
+{
+	struct stream_flash_ctx *ctx =
+		CONTAINER_OF(work, struct stream_flash_ctx, erase_work);
+	off_t limit = ctx->offset + ctx->available;
+	struct flash_pages_info page;
+	uint32_t last_index = 0U;
+	off_t write_addr;
+	int rc = 0;
+
+	/* One page at a time, so that writes are not held back longer */
+	while (rc == 0) {
+		k_mutex_lock(&ctx->lock, K_FOREVER);
+
+		/* Only the erased range being written to is extended */
+		write_addr = ctx->offset + ctx->bytes_written;
+		if (!ctx->erase_ahead || write_addr < ctx->erased_start ||
+		    write_addr > ctx->erased_end) {
+			k_mutex_unlock(&ctx->lock);
+			break;
+		}
+
+		rc = flash_get_page_info_by_offs(ctx->fdev, write_addr, &page);
+		if (rc == 0) {
+			last_index = page.index + ctx->erase_ahead;
+			rc = flash_get_page_info_by_offs(ctx->fdev,
+							 ctx->erased_end,
+							 &page);
+		}
+
+		if (rc != 0 || page.index > last_index ||
+		    page.start_offset + page.size > limit) {
+			k_mutex_unlock(&ctx->lock);
+			break;
+		}
+
+		rc = erase_page(ctx, &page, true);
+		k_mutex_unlock(&ctx->lock);
+	}
+}
+
+static void erase_ahead_start(struct stream_flash_ctx *ctx)
+{
+	if (ctx->erase_ahead) {
+		k_work_submit_to_queue(&erase_ahead_workq, &ctx->erase_work);
 	}
+}
 
-	LOG_DBG("Erasing page at offset 0x%08lx", (long)page.start_offset);
+static void erase_ahead_cancel(struct stream_flash_ctx *ctx)
+{
+	struct k_work_sync sync;
 
-	rc = flash_erase(ctx->fdev, page.start_offset, page.size);
+	(void)k_work_cancel_sync(&ctx->erase_work, &sync);
+}
 
-	if (rc != 0) {
-		LOG_ERR("Error %d while erasing page", rc);
+int stream_flash_erase_ahead(struct stream_flash_ctx *ctx, uint8_t pages)
+{
+	if (!ctx) {
+		return -EFAULT;
+	}
+
+	k_mutex_lock(&ctx->lock, K_FOREVER);
+	ctx->erase_ahead = pages;
+	k_mutex_unlock(&ctx->lock);
+
+	if (pages) {
+		erase_ahead_start(ctx);
 	} else {
-		ctx->last_erased_page_start_offset = page.start_offset;
+		erase_ahead_cancel(ctx);
 	}
 
-	return rc;
+	return 0;
 }
 
-#endif /* CONFIG_STREAM_FLASH_ERASE */
+static int erase_ahead_init(const struct device *dev)
+{
+	const struct k_work_queue_config cfg = {
+		.name = "stream_flash",
+	};
 
-static int flash_sync(struct stream_flash_ctx *ctx)
+	ARG_UNUSED(dev);
+
+	k_work_queue_start(&erase_ahead_workq, erase_ahead_stack,
+			   K_KERNEL_STACK_SIZEOF(erase_ahead_stack),
+			   CONFIG_STREAM_FLASH_ERASE_AHEAD_PRIORITY, &cfg);
+
+	return 0;
+}
+
+SYS_INIT(erase_ahead_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+#else
+static inline void erase_ahead_start(struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+
+static inline void erase_ahead_cancel(struct stream_flash_ctx *ctx)
+{
+	ARG_UNUSED(ctx);
+}
+#endif /* CONFIG_STREAM_FLASH_ERASE_AHEAD */
+
+static int flash_sync_locked(struct stream_flash_ctx *ctx)
 {
 	int rc = 0;
 	size_t write_addr = ctx->offset + ctx->bytes_written;
@@ -117,16 +322,13 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 		return 0;
 	}
 
-	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE)) {
-
-		rc = stream_flash_erase_page(ctx,
-					     write_addr + ctx->buf_bytes - 1);
-		if (rc < 0) {
-			LOG_ERR("stream_flash_erase_page err %d offset=0x%08zx",
-				rc, write_addr);
-			return rc;
-		}
+#ifdef CONFIG_STREAM_FLASH_ERASE
+	rc = erase_range(ctx, write_addr, ctx->buf_bytes);
+	if (rc < 0) {
+		LOG_ERR("erase_range err %d offset=0x%08zx", rc, write_addr);
+		return rc;
 	}
+#endif
 
 	fill_length = flash_get_write_block_size(ctx->fdev);
 	if (ctx->buf_bytes % fill_length) {
@@ -175,6 +377,52 @@ static int flash_sync(struct stream_flash_ctx *ctx)
 	return rc;
 }
 
+static int flash_sync(struct stream_flash_ctx *ctx)
+{
+	int rc;
+
+	ctx_lock(ctx);
+	rc = flash_sync_locked(ctx);
+	ctx_unlock(ctx);
+
+	if (rc == 0) {
+		erase_ahead_start(ctx);
+	}
+
+	return rc;
+}
+
+/* Program whole buffers straight from the data, in one operation */
+static int flash_write_direct(struct stream_flash_ctx *ctx,
+			      const uint8_t *data, size_t len)
+{
+	size_t write_addr = ctx->offset + ctx->bytes_written;
+	int rc = 0;
+
+	ctx_lock(ctx);
+
+#ifdef CONFIG_STREAM_FLASH_ERASE
+	rc = erase_range(ctx, write_addr, len);
+#endif
+	if (rc == 0) {
+		rc = flash_write(ctx->fdev, write_addr, data, len);
+		if (rc != 0) {
+			LOG_ERR("flash_write error %d offset=0x%08zx", rc,
+				write_addr);
+		} else {
+			ctx->bytes_written += len;
+		}
+	}
+
+	ctx_unlock(ctx);
+
+	if (rc == 0) {
+		erase_ahead_start(ctx);
+	}
+
+	return rc;
+}
+
 int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *data,
 				size_t len, bool flush)
 {
@@ -192,6 +440,20 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 
 	while ((len - processed) >=
 	       (buf_empty_bytes = ctx->buf_len - ctx->buf_bytes)) {
+		if (IS_ENABLED(CONFIG_STREAM_FLASH_WRITE_COALESCE) &&
+		    ctx->buf_bytes == 0U && !ctx->callback) {
+			size_t direct = ROUND_DOWN(len - processed,
+						   ctx->buf_len);
+
+			rc = flash_write_direct(ctx, data + processed, direct);
+			if (rc != 0) {
+				return rc;
+			}
+
+			processed += direct;
+			continue;
+		}
+
 		memcpy(ctx->buf + ctx->buf_bytes, data + processed,
 		       buf_empty_bytes);
 
@@ -216,6 +478,10 @@ int stream_flash_buffered_write(struct stream_flash_ctx *ctx, const uint8_t *dat
 		rc = flash_sync(ctx);
 	}
 
+	if (flush) {
+		erase_ahead_cancel(ctx);
+	}
+
 	return rc;
 }
 
@@ -286,6 +552,13 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 		return -EFAULT;
 	}
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	/* A context used before may still have erase ahead running on it */
+	if (ctx->erase_work.handler == erase_ahead_work) {
+		erase_ahead_cancel(ctx);
+	}
+#endif
+
 	ctx->fdev = fdev;
 	ctx->buf = buf;
 	ctx->buf_len = buf_len;
@@ -300,6 +573,14 @@ int stream_flash_init(struct stream_flash_ctx *ctx, const struct device *fdev,
 	ctx->last_erased_page_start_offset = -1;
 #endif
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+	k_work_init(&ctx->erase_work, erase_ahead_work);
+	k_mutex_init(&ctx->lock);
+	ctx->erased_start = 0;
+	ctx->erased_end = 0;
+	ctx->erase_ahead = 0U;
+#endif
+
 	return 0;
 }
 
@@ -9,6 +9,7 @@
 
 #include <stdbool.h>
 #include <zephyr/types.h>
+#include <tracing/tracing_format.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -113,6 +114,41 @@ uint32_t tracing_buffer_get(uint8_t *data, uint32_t size);
  */
 uint32_t tracing_cmd_buffer_alloc(uint8_t **data);
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+/**
+ * @brief Write one record to the tracing buffer of the current CPU.
+ *
+ * The record is the concatenation of the @a count data items. Must be
+ * called with local interrupts locked, no other lock is taken.
+ *
+ * @param data Array of data items.
+ * @param count Number of data items.
+ *
+ * @retval 0 Successful operation.
+ * @retval -ENOMEM Not enough free space, nothing was written.
+ */
+int tracing_buffer_cpu_put(tracing_data_t *data, uint32_t count);
+
+/**
+ * @brief Move records from the per-CPU tracing buffers to an output buffer.
+ *
+ * Records are taken in timestamp order across CPUs until the output
+ * buffer cannot hold the next one. With CONFIG_TRACING_BUFFER_PER_CPU_TAG
+ * each record is prefixed with the id of the CPU it was written on.
+ *
+ * @param data Address of the output buffer.
+ * @param size Output buffer size (in bytes), at least
+ *             TRACING_BUFFER_RECORD_MAX_SIZE + 1.
+ *
+ * @return Number of bytes written to the output buffer.
+ */
+uint32_t tracing_buffer_merge(uint8_t *data, uint32_t size);
+
+/** Largest record accepted by tracing_buffer_cpu_put() */
+#define TRACING_BUFFER_RECORD_MAX_SIZE 255U
+#endif
+
+
 #ifdef __cplusplus
 }
 #endif
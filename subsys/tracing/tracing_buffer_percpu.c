@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <string.h>
+#include <sys/atomic.h>
+#include <kernel_structs.h>
+#include <tracing_buffer.h>
+
+/*
+ * One single producer, single consumer byte ring per CPU. A CPU only writes
+ * its own buffer, with its local interrupts locked, so producers never
+ * contend with each other. The tracing thread is the only consumer and
+ * merges the buffers by timestamp.
+ *
+ * Each record is a header followed by the payload. The producer publishes
+ * a record by moving tail after copying it, the consumer frees it by moving
+ * head after copying it out. One byte always stays unused so that
+ * head == tail means empty.
+ */
+
+#define BUF_SIZE (CONFIG_TRACING_BUFFER_SIZE + 1)
+
+struct record_hdr {
+	uint32_t timestamp;
+	uint8_t length;
+} __packed;
+
+struct cpu_buffer {
+	atomic_t head;
+	atomic_t tail;
+	uint8_t data[BUF_SIZE];
+};
+
+static struct cpu_buffer cpu_buffers[CONFIG_MP_NUM_CPUS];
+static uint8_t tracing_cmd_buffer[CONFIG_TRACING_CMD_BUFFER_SIZE];
+
+uint32_t tracing_cmd_buffer_alloc(uint8_t **data)
+{
+	*data = &tracing_cmd_buffer[0];
+
+	return sizeof(tracing_cmd_buffer);
+}
+
+static uint32_t used_get(uint32_t head, uint32_t tail)
+{
+	return (tail >= head) ? (tail - head) : (BUF_SIZE - head + tail);
+}
+
+/* Copy into the ring at @a pos, returns the position past the copy */
+static uint32_t copy_in(struct cpu_buffer *buf, uint32_t pos,
+			const void *src, uint32_t size)
+{
+	uint32_t part = MIN(size, BUF_SIZE - pos);
+
+	(void)memcpy(&buf->data[pos], src, part);
+	(void)memcpy(&buf->data[0], (const uint8_t *)src + part, size - part);
+
+	pos += size;
+
+	return (pos >= BUF_SIZE) ? (pos - BUF_SIZE) : pos;
+}
+
+/* Copy out of the ring at @a pos, returns the position past the copy */
+static uint32_t copy_out(struct cpu_buffer *buf, uint32_t pos,
+			 void *dst, uint32_t size)
+{
+	uint32_t part = MIN(size, BUF_SIZE - pos);
+
+	(void)memcpy(dst, &buf->data[pos], part);
+	(void)memcpy((uint8_t *)dst + part, &buf->data[0], size - part);
+
+	pos += size;
+
+	return (pos >= BUF_SIZE) ? (pos - BUF_SIZE) : pos;
+}
+
+int tracing_buffer_cpu_put(tracing_data_t *data, uint32_t count)
+{
+	struct cpu_buffer *buf = &cpu_buffers[_current_cpu->id];
+	uint32_t head = (uint32_t)atomic_get(&buf->head);
+	uint32_t tail = (uint32_t)atomic_get(&buf->tail);
+	struct record_hdr hdr;
+	uint32_t length = 0U;
+
+	for (uint32_t i = 0; i < count; i++) {
+		length += data[i].length;
+	}
+
+	if ((length > TRACING_BUFFER_RECORD_MAX_SIZE) ||
+	    ((BUF_SIZE - 1 - used_get(head, tail)) < (sizeof(hdr) + length))) {
+		return -ENOMEM;
+	}
+
+	hdr.timestamp = k_cycle_get_32();
+	hdr.length = (uint8_t)length;
+
+	tail = copy_in(buf, tail, &hdr, sizeof(hdr));
+	for (uint32_t i = 0; i < count; i++) {
+		tail = copy_in(buf, tail, data[i].data, data[i].length);
+	}
+
+	/* Publish the record, ordered after its contents */
+	(void)atomic_set(&buf->tail, (atomic_val_t)tail);
+
+	return 0;
+}
+
+uint32_t tracing_buffer_merge(uint8_t *data, uint32_t size)
+{
+	const uint32_t tag_size =
+		IS_ENABLED(CONFIG_TRACING_BUFFER_PER_CPU_TAG) ? 1U : 0U;
+	uint32_t total = 0U;
+
+	while (true) {
+		struct cpu_buffer *oldest = NULL;
+		struct record_hdr hdr, oldest_hdr;
+		uint8_t oldest_cpu = 0U;
+		uint32_t head;
+
+		for (uint8_t cpu = 0U; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+			struct cpu_buffer *buf = &cpu_buffers[cpu];
+
+			head = (uint32_t)atomic_get(&buf->head);
+			if (head == (uint32_t)atomic_get(&buf->tail)) {
+				continue;
+			}
+
+			(void)copy_out(buf, head, &hdr, sizeof(hdr));
+
+			/* Timestamps wrap, compare their difference */
+			if ((oldest == NULL) ||
+			    ((int32_t)(hdr.timestamp -
+				       oldest_hdr.timestamp) < 0)) {
+				oldest = buf;
+				oldest_hdr = hdr;
+				oldest_cpu = cpu;
+			}
+		}
+
+		if ((oldest == NULL) ||
+		    ((size - total) < (tag_size + oldest_hdr.length))) {
+			break;
+		}
+
+		if (tag_size != 0U) {
+			data[total] = oldest_cpu;
+		}
+		total += tag_size;
+
+		head = (uint32_t)atomic_get(&oldest->head);
+		head = copy_out(oldest, head, &hdr, sizeof(hdr));
+		head = copy_out(oldest, head, &data[total], hdr.length);
+		total += hdr.length;
+
+		/* Free the record, ordered after reading it out */
+		(void)atomic_set(&oldest->head, (atomic_val_t)head);
+	}
+
+	return total;
+}
+
+void tracing_buffer_init(void)
+{
+	for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+		atomic_set(&cpu_buffers[cpu].head, 0);
+		atomic_set(&cpu_buffers[cpu].tail, 0);
+	}
+}
+
+bool tracing_buffer_is_empty(void)
+{
+	for (int cpu = 0; cpu < CONFIG_MP_NUM_CPUS; cpu++) {
+		if (atomic_get(&cpu_buffers[cpu].head) !=
+		    atomic_get(&cpu_buffers[cpu].tail)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+uint32_t tracing_buffer_capacity_get(void)
+{
+	return BUF_SIZE - 1;
+}
+
+uint32_t tracing_buffer_space_get(void)
+{
+	struct cpu_buffer *buf = &cpu_buffers[_current_cpu->id];
+
+	return BUF_SIZE - 1 - used_get((uint32_t)atomic_get(&buf->head),
+				       (uint32_t)atomic_get(&buf->tail));
+}
@@ -47,6 +47,30 @@ static K_SEM_DEFINE(tracing_thread_sem, 0, 1);
 static K_THREAD_STACK_DEFINE(tracing_thread_stack,
 			CONFIG_TRACING_THREAD_STACK_SIZE);
 
+#ifdef CONFIG_TRACING_BUFFER_PER_CPU
+/* Records of all CPUs are merged here in timestamp order */
+static uint8_t tracing_merge_buffer[2 * (TRACING_BUFFER_RECORD_MAX_SIZE + 1)];
+
+static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
+{
+	uint32_t transferring_length;
+
+	tracing_thread_tid = k_current_get();
+
+	while (true) {
+		if (tracing_buffer_is_empty()) {
+			k_sem_take(&tracing_thread_sem, K_FOREVER);
+		} else {
+			transferring_length =
+				tracing_buffer_merge(
+						tracing_merge_buffer,
+						sizeof(tracing_merge_buffer));
+			tracing_buffer_handle(tracing_merge_buffer,
+					      transferring_length);
+		}
+	}
+}
+#else
 static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 {
 	uint8_t *transferring_buf;
@@ -70,6 +94,7 @@ static void tracing_thread_func(void *dummy1, void *dummy2, void *dummy3)
 		}
 	}
 }
+#endif
 
 static void tracing_thread_timer_expiry_fn(struct k_timer *timer)
 {
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <kernel.h>
+#include <sys/printk.h>
+#include <tracing_core.h>
+#include <tracing_buffer.h>
+#include <tracing_format_common.h>
+
+/*
+ * Asynchronous tracing through per-CPU buffers. Only local interrupts are
+ * locked while an event is written, irq_lock() would serialize all CPUs on
+ * SMP.
+ */
+static void tracing_format_put(tracing_data_t *data, uint32_t count)
+{
+	bool before_put_is_empty;
+	unsigned int key;
+	int ret;
+
+	key = arch_irq_lock();
+	before_put_is_empty = tracing_buffer_is_empty();
+	ret = tracing_buffer_cpu_put(data, count);
+	arch_irq_unlock(key);
+
+	if (ret == 0) {
+		tracing_trigger_output(before_put_is_empty);
+	} else {
+		tracing_packet_drop_handle();
+	}
+}
+
+void tracing_format_string(const char *str, ...)
+{
+	char buf[CONFIG_TRACING_PACKET_MAX_SIZE];
+	tracing_data_t data = { .data = (uint8_t *)buf };
+	va_list args;
+	int length;
+
+	if (!is_tracing_enabled() || is_tracing_thread()) {
+		return;
+	}
+
+	va_start(args, str);
+	length = vsnprintk(buf, sizeof(buf), str, args);
+	va_end(args);
+
+	if ((length < 0) || ((size_t)length >= sizeof(buf))) {
+		tracing_packet_drop_handle();
+		return;
+	}
+
+	data.length = length;
+	tracing_format_put(&data, 1);
+}
+
+void tracing_format_raw_data(uint8_t *data, uint32_t length)
+{
+	tracing_data_t tracing_data = { .data = data, .length = length };
+
+	if (!is_tracing_enabled() || is_tracing_thread()) {
+		return;
+	}
+
+	tracing_format_put(&tracing_data, 1);
+}
+
+void tracing_format_data(tracing_data_t *tracing_data_array, uint32_t count)
+{
+	if (!is_tracing_enabled() || is_tracing_thread()) {
+		return;
+	}
+
+	tracing_format_put(tracing_data_array, count);
+}
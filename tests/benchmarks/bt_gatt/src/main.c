@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * GATT database lookup benchmark. A few hundred attributes are registered
+ * as dynamic services, next to the static GAP and GATT services, and the
+ * lookups done by the ATT server are measured on their own, without any
+ * connection: resolving the handle of a read or write request, finding the
+ * CCC descriptor of a characteristic when notifying and discovering all
+ * characteristics.
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <timing/timing.h>
+#include <bluetooth/bluetooth.h>
+#include <bluetooth/gatt.h>
+#include <bluetooth/uuid.h>
+
+#define NUM_SERVICES 96
+#define N_ITERATIONS 1000
+#define N_DISCOVERIES 50
+
+#define FORMAT "%-60s:%8u cycles , %8u ns\n"
+#define OPS_FORMAT "%-60s:%8u ops/s\n"
+
+static struct bt_uuid_128 value_uuid = BT_UUID_INIT_128(
+	0xf0, 0xde, 0xbc, 0x9a, 0x78, 0x56, 0x34, 0x12,
+	0x78, 0x56, 0x34, 0x12, 0x78, 0x56, 0x34, 0x12);
+
+static uint8_t value;
+
+static ssize_t read_value(struct bt_conn *conn,
+			  const struct bt_gatt_attr *attr, void *buf,
+			  uint16_t len, uint16_t offset)
+{
+	return bt_gatt_attr_read(conn, attr, buf, len, offset, &value,
+				 sizeof(value));
+}
+
+/* Copied into each of the registered services */
+static const struct bt_gatt_attr svc_template[] = {
+	BT_GATT_PRIMARY_SERVICE(BT_UUID_DECLARE_16(0xfff0)),
+	BT_GATT_CHARACTERISTIC(&value_uuid.uuid,
+			       BT_GATT_CHRC_READ | BT_GATT_CHRC_NOTIFY,
+			       BT_GATT_PERM_READ, read_value, NULL, NULL),
+	BT_GATT_CCC(NULL, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE),
+};
+
+#define VALUE_ATTR 2
+
+static struct bt_gatt_attr attrs[NUM_SERVICES][ARRAY_SIZE(svc_template)];
+static struct bt_gatt_service services[NUM_SERVICES];
+
+static uint16_t first_handle;
+static uint16_t last_handle;
+
+static uint8_t count_attr(const struct bt_gatt_attr *attr, uint16_t handle,
+			  void *user_data)
+{
+	uint32_t *count = user_data;
+
+	(*count)++;
+
+	return BT_GATT_ITER_CONTINUE;
+}
+
+static void report(const char *name, uint32_t ops, uint64_t cycles)
+{
+	uint64_t ns = timing_cycles_to_ns(cycles);
+	uint64_t rate = (ns != 0U) ? ((uint64_t)ops * NSEC_PER_SEC) / ns : 0U;
+
+	printk(FORMAT, name, (uint32_t)(cycles / ops),
+	       (uint32_t)timing_cycles_to_ns_avg(cycles, ops));
+	printk(OPS_FORMAT, name, (uint32_t)rate);
+}
+
+static int register_services(void)
+{
+	int err;
+
+	for (int i = 0; i < NUM_SERVICES; i++) {
+		memcpy(attrs[i], svc_template, sizeof(svc_template));
+		services[i].attrs = attrs[i];
+		services[i].attr_count = ARRAY_SIZE(svc_template);
+
+		err = bt_gatt_service_register(&services[i]);
+		if (err) {
+			printk("Registering service %d failed (err %d)\n", i,
+			       err);
+			return err;
+		}
+	}
+
+	first_handle = attrs[0][0].handle;
+	last_handle = attrs[NUM_SERVICES - 1][VALUE_ATTR + 1].handle;
+
+	return 0;
+}
+
+/* Read and write requests resolve a single handle */
+static int bench_handle_lookup(void)
+{
+	uint32_t span = last_handle - first_handle + 1;
+	uint32_t count = 0U;
+	timing_t start, end;
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < N_ITERATIONS; i++) {
+		uint16_t handle = first_handle + (i * 7U) % span;
+
+		bt_gatt_foreach_attr(handle, handle, count_attr, &count);
+	}
+	end = timing_counter_get();
+
+	if (count != N_ITERATIONS) {
+		printk("Handle lookup found %u attributes\n", count);
+		return -EIO;
+	}
+
+	report("handle lookup (ATT read/write request)", N_ITERATIONS,
+	       timing_cycles_get(&start, &end));
+
+	return 0;
+}
+
+/* Notifications search for the CCC descriptor following the value */
+static int bench_ccc_lookup(void)
+{
+	uint32_t count = 0U;
+	timing_t start, end;
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < N_ITERATIONS; i++) {
+		const struct bt_gatt_attr *attr;
+
+		attr = &attrs[(i * 7U) % NUM_SERVICES][VALUE_ATTR];
+		bt_gatt_foreach_attr_type(attr->handle, 0xffff,
+					  BT_UUID_GATT_CCC, NULL, 1,
+					  count_attr, &count);
+	}
+	end = timing_counter_get();
+
+	if (count != N_ITERATIONS) {
+		printk("CCC lookup found %u attributes\n", count);
+		return -EIO;
+	}
+
+	report("CCC lookup (notification)", N_ITERATIONS,
+	       timing_cycles_get(&start, &end));
+
+	return 0;
+}
+
+/* Characteristic discovery over the whole database */
+static int bench_discovery(void)
+{
+	uint32_t count = 0U;
+	timing_t start, end;
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < N_DISCOVERIES; i++) {
+		bt_gatt_foreach_attr_type(0x0001, 0xffff, BT_UUID_GATT_CHRC,
+					  NULL, 0, count_attr, &count);
+	}
+	end = timing_counter_get();
+
+	if (count < N_DISCOVERIES * NUM_SERVICES) {
+		printk("Discovery found %u characteristics\n", count);
+		return -EIO;
+	}
+
+	report("characteristic discovery, whole database", N_DISCOVERIES,
+	       timing_cycles_get(&start, &end));
+
+	return 0;
+}
+
+void main(void)
+{
+	if (register_services()) {
+		return;
+	}
+
+	printk("%u attributes, dynamic handles 0x%04x-0x%04x\n",
+	       last_handle, first_handle, last_handle);
+
+	timing_init();
+	timing_start();
+
+	if (bench_handle_lookup() || bench_ccc_lookup() ||
+	    bench_discovery()) {
+		timing_stop();
+		return;
+	}
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Simulated controller: answers the HCI commands the host sends when
+ * enabling Bluetooth and advertising, reports connections on request and
+ * completes every ACL packet as soon as the host sends it, counting the
+ * notifications it carries.
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <sys/atomic.h>
+#include <sys/byteorder.h>
+
+#include <bluetooth/hci.h>
+#include <bluetooth/buf.h>
+#include <bluetooth/gap.h>
+#include <drivers/bluetooth/hci_driver.h>
+
+#include "controller.h"
+
+#define L2CAP_CID_ATT 0x0004
+
+#define ATT_OP_NOTIFY 0x1b
+#define ATT_OP_NOTIFY_MULT 0x23
+
+struct l2cap_hdr {
+	uint16_t len;
+	uint16_t cid;
+} __packed;
+
+struct cmd_handler {
+	uint16_t opcode;
+	uint8_t len;
+	void (*handler)(struct net_buf **evt, uint8_t len, uint16_t opcode);
+};
+
+static atomic_t acl_packets;
+static atomic_t notifications;
+static atomic_t expected;
+static K_SEM_DEFINE(done_sem, 0, 1);
+
+static uint8_t att_rsp_op;
+static K_SEM_DEFINE(att_rsp_sem, 0, 1);
+
+static void evt_create(struct net_buf *buf, uint8_t evt, uint8_t len)
+{
+	struct bt_hci_evt_hdr *hdr;
+
+	hdr = net_buf_add(buf, sizeof(*hdr));
+	hdr->evt = evt;
+	hdr->len = len;
+}
+
+static void *cmd_complete(struct net_buf **buf, uint8_t plen, uint16_t opcode)
+{
+	struct bt_hci_evt_cmd_complete *cc;
+
+	*buf = bt_buf_get_evt(BT_HCI_EVT_CMD_COMPLETE, false, K_FOREVER);
+	evt_create(*buf, BT_HCI_EVT_CMD_COMPLETE, sizeof(*cc) + plen);
+	cc = net_buf_add(*buf, sizeof(*cc));
+	cc->ncmd = 1U;
+	cc->opcode = sys_cpu_to_le16(opcode);
+
+	return net_buf_add(*buf, plen);
+}
+
+static void generic_success(struct net_buf **evt, uint8_t len,
+			    uint16_t opcode)
+{
+	struct bt_hci_evt_cc_status *ccst;
+
+	ccst = cmd_complete(evt, len, opcode);
+	(void)memset(ccst, 0, len);
+	ccst->status = BT_HCI_ERR_SUCCESS;
+}
+
+static void read_local_features(struct net_buf **evt, uint8_t len,
+				uint16_t opcode)
+{
+	struct bt_hci_rp_read_local_features *rp;
+
+	rp = cmd_complete(evt, sizeof(*rp), opcode);
+	rp->status = 0x00;
+	(void)memset(&rp->features[0], 0xFF, sizeof(rp->features));
+}
+
+static void read_supported_commands(struct net_buf **evt, uint8_t len,
+				    uint16_t opcode)
+{
+	struct bt_hci_rp_read_supported_commands *rp;
+
+	rp = cmd_complete(evt, sizeof(*rp), opcode);
+	rp->status = 0x00;
+	(void)memset(&rp->commands[0], 0xFF, sizeof(rp->commands));
+}
+
+/* No optional LE feature, so that the host starts no procedure of its own
+ * on new connections.
+ */
+static void le_read_local_features(struct net_buf **evt, uint8_t len,
+				   uint16_t opcode)
+{
+	struct bt_hci_rp_le_read_local_features *rp;
+
+	rp = cmd_complete(evt, sizeof(*rp), opcode);
+	rp->status = 0x00;
+	(void)memset(&rp->features[0], 0x00, sizeof(rp->features));
+}
+
+static void le_read_buffer_size(struct net_buf **evt, uint8_t len,
+				uint16_t opcode)
+{
+	struct bt_hci_rp_le_read_buffer_size *rp;
+
+	rp = cmd_complete(evt, sizeof(*rp), opcode);
+	rp->status = 0x00;
+	rp->le_max_len = sys_cpu_to_le16(CONTROLLER_ACL_MTU);
+	rp->le_max_num = CONTROLLER_ACL_COUNT;
+}
+
+/* All states, advertising while connected included */
+static void le_read_supp_states(struct net_buf **evt, uint8_t len,
+				uint16_t opcode)
+{
+	struct bt_hci_rp_le_read_supp_states *rp;
+
+	rp = cmd_complete(evt, sizeof(*rp), opcode);
+	rp->status = 0x00;
+	(void)memset(&rp->le_states, 0xFF, sizeof(rp->le_states));
+}
+
+static const struct cmd_handler cmds[] = {
+	{ BT_HCI_OP_READ_LOCAL_VERSION_INFO,
+	  sizeof(struct bt_hci_rp_read_local_version_info),
+	  generic_success },
+	{ BT_HCI_OP_READ_SUPPORTED_COMMANDS,
+	  sizeof(struct bt_hci_rp_read_supported_commands),
+	  read_supported_commands },
+	{ BT_HCI_OP_READ_LOCAL_FEATURES,
+	  sizeof(struct bt_hci_rp_read_local_features),
+	  read_local_features },
+	{ BT_HCI_OP_READ_BD_ADDR,
+	  sizeof(struct bt_hci_rp_read_bd_addr),
+	  generic_success },
+	{ BT_HCI_OP_SET_EVENT_MASK,
+	  sizeof(struct bt_hci_evt_cc_status),
+	  generic_success },
+	{ BT_HCI_OP_LE_SET_EVENT_MASK,
+	  sizeof(struct bt_hci_evt_cc_status),
+	  generic_success },
+	{ BT_HCI_OP_LE_READ_LOCAL_FEATURES,
+	  sizeof(struct bt_hci_rp_le_read_local_features),
+	  le_read_local_features },
+	{ BT_HCI_OP_LE_READ_BUFFER_SIZE,
+	  sizeof(struct bt_hci_rp_le_read_buffer_size),
+	  le_read_buffer_size },
+	{ BT_HCI_OP_LE_READ_SUPP_STATES,
+	  sizeof(struct bt_hci_rp_le_read_supp_states),
+	  le_read_supp_states },
+	{ BT_HCI_OP_LE_RAND,
+	  sizeof(struct bt_hci_rp_le_rand),
+	  generic_success },
+	{ BT_HCI_OP_LE_SET_RANDOM_ADDRESS,
+	  sizeof(struct bt_hci_evt_cc_status),
+	  generic_success },
+	{ BT_HCI_OP_LE_SET_ADV_PARAM,
+	  sizeof(struct bt_hci_evt_cc_status),
+	  generic_success },
+	{ BT_HCI_OP_LE_SET_ADV_DATA,
+	  sizeof(struct bt_hci_evt_cc_status),
+	  generic_success },
+	{ BT_HCI_OP_LE_SET_SCAN_RSP_DATA,
+	  sizeof(struct bt_hci_evt_cc_status),
+	  generic_success },
+	{ BT_HCI_OP_LE_SET_ADV_ENABLE,
+	  sizeof(struct bt_hci_evt_cc_status),
+	  generic_success },
+};
+
+static void cmd_handle(struct net_buf *cmd)
+{
+	struct net_buf *evt = NULL;
+	struct bt_hci_cmd_hdr *chdr;
+	uint16_t opcode;
+
+	chdr = net_buf_pull_mem(cmd, sizeof(*chdr));
+	opcode = sys_le16_to_cpu(chdr->opcode);
+
+	for (size_t i = 0; i < ARRAY_SIZE(cmds); i++) {
+		if (cmds[i].opcode == opcode) {
+			cmds[i].handler(&evt, cmds[i].len, opcode);
+			break;
+		}
+	}
+
+	if (!evt) {
+		struct bt_hci_evt_cc_status *ccst;
+
+		ccst = cmd_complete(&evt, sizeof(*ccst), opcode);
+		ccst->status = BT_HCI_ERR_UNKNOWN_CMD;
+	}
+
+	bt_recv(evt);
+}
+
+static uint32_t count_notifications(const uint8_t *pdu, uint16_t len)
+{
+	uint32_t count = 0U;
+
+	switch (pdu[0]) {
+	case ATT_OP_NOTIFY:
+		return 1U;
+	case ATT_OP_NOTIFY_MULT:
+		/* Handle, length and value tuples */
+		for (uint16_t i = 1U; i + 4U <= len;
+		     i += 4U + sys_get_le16(&pdu[i + 2])) {
+			count++;
+		}
+		return count;
+	default:
+		return 0U;
+	}
+}
+
+static void acl_handle(struct net_buf *buf)
+{
+	struct bt_hci_acl_hdr *acl;
+	struct l2cap_hdr *l2cap;
+	struct bt_hci_evt_num_completed_packets *ncp;
+	struct net_buf *evt;
+	uint16_t handle;
+	uint32_t count;
+
+	acl = net_buf_pull_mem(buf, sizeof(*acl));
+	handle = sys_le16_to_cpu(acl->handle);
+
+	(void)atomic_inc(&acl_packets);
+
+	/* The host fragments nothing bigger than the reported ACL MTU */
+	if (bt_acl_flags_pb(bt_acl_flags(handle)) == BT_ACL_START_NO_FLUSH &&
+	    buf->len > sizeof(*l2cap)) {
+		l2cap = net_buf_pull_mem(buf, sizeof(*l2cap));
+
+		if (sys_le16_to_cpu(l2cap->cid) == L2CAP_CID_ATT) {
+			count = count_notifications(buf->data, buf->len);
+			count += (uint32_t)atomic_add(&notifications, count);
+			if (count == (uint32_t)atomic_get(&expected)) {
+				k_sem_give(&done_sem);
+			}
+
+			if (buf->data[0] == att_rsp_op) {
+				k_sem_give(&att_rsp_sem);
+			}
+		}
+	}
+
+	/* Complete the packet right away */
+	evt = bt_buf_get_evt(BT_HCI_EVT_NUM_COMPLETED_PACKETS, false,
+			     K_FOREVER);
+	evt_create(evt, BT_HCI_EVT_NUM_COMPLETED_PACKETS,
+		   sizeof(*ncp) + sizeof(ncp->h[0]));
+	ncp = net_buf_add(evt, sizeof(*ncp) + sizeof(ncp->h[0]));
+	ncp->num_handles = 1U;
+	ncp->h[0].handle = sys_cpu_to_le16(bt_acl_handle(handle));
+	ncp->h[0].count = sys_cpu_to_le16(1U);
+
+	bt_recv(evt);
+}
+
+static int driver_open(void)
+{
+	return 0;
+}
+
+static int driver_send(struct net_buf *buf)
+{
+	switch (bt_buf_get_type(buf)) {
+	case BT_BUF_CMD:
+		cmd_handle(buf);
+		break;
+	case BT_BUF_ACL_OUT:
+		acl_handle(buf);
+		break;
+	default:
+		break;
+	}
+
+	net_buf_unref(buf);
+
+	return 0;
+}
+
+static const struct bt_hci_driver drv = {
+	.name = "bench",
+	.bus = BT_HCI_DRIVER_BUS_VIRTUAL,
+	.open = driver_open,
+	.send = driver_send,
+	.quirks = BT_QUIRK_NO_RESET,
+};
+
+int controller_init(void)
+{
+	return bt_hci_driver_register(&drv);
+}
+
+void controller_connect(uint16_t handle, const bt_addr_le_t *peer)
+{
+	struct bt_hci_evt_le_meta_event *meta;
+	struct bt_hci_evt_le_conn_complete *cc;
+	struct net_buf *buf;
+
+	buf = bt_buf_get_evt(BT_HCI_EVT_LE_META_EVENT, false, K_FOREVER);
+	evt_create(buf, BT_HCI_EVT_LE_META_EVENT, sizeof(*meta) + sizeof(*cc));
+	meta = net_buf_add(buf, sizeof(*meta));
+	meta->subevent = BT_HCI_EVT_LE_CONN_COMPLETE;
+
+	cc = net_buf_add(buf, sizeof(*cc));
+	(void)memset(cc, 0, sizeof(*cc));
+	cc->status = BT_HCI_ERR_SUCCESS;
+	cc->handle = sys_cpu_to_le16(handle);
+	cc->role = BT_HCI_ROLE_SLAVE;
+	bt_addr_le_copy(&cc->peer_addr, peer);
+	cc->interval = sys_cpu_to_le16(BT_GAP_INIT_CONN_INT_MIN);
+	cc->supv_timeout = sys_cpu_to_le16(400);
+
+	bt_recv(buf);
+}
+
+int controller_att_request(uint16_t handle, const void *pdu, uint16_t len,
+			   uint8_t rsp_op, k_timeout_t timeout)
+{
+	struct bt_hci_acl_hdr *acl;
+	struct l2cap_hdr *l2cap;
+	struct net_buf *buf;
+
+	k_sem_reset(&att_rsp_sem);
+	att_rsp_op = rsp_op;
+
+	buf = bt_buf_get_rx(BT_BUF_ACL_IN, K_FOREVER);
+
+	acl = net_buf_add(buf, sizeof(*acl));
+	acl->handle = sys_cpu_to_le16(bt_acl_handle_pack(handle,
+							 BT_ACL_START));
+	acl->len = sys_cpu_to_le16(sizeof(*l2cap) + len);
+
+	l2cap = net_buf_add(buf, sizeof(*l2cap));
+	l2cap->len = sys_cpu_to_le16(len);
+	l2cap->cid = sys_cpu_to_le16(L2CAP_CID_ATT);
+
+	net_buf_add_mem(buf, pdu, len);
+
+	bt_recv(buf);
+
+	return k_sem_take(&att_rsp_sem, timeout);
+}
+
+void controller_expect(uint32_t count)
+{
+	k_sem_reset(&done_sem);
+	atomic_set(&acl_packets, 0);
+	atomic_set(&notifications, 0);
+	atomic_set(&expected, count);
+}
+
+int controller_wait(k_timeout_t timeout)
+{
+	return k_sem_take(&done_sem, timeout);
+}
+
+void controller_stats_get(struct controller_stats *stats)
+{
+	stats->acl_packets = (uint32_t)atomic_get(&acl_packets);
+	stats->notifications = (uint32_t)atomic_get(&notifications);
+}
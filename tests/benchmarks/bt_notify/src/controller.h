@@ -0,0 +1,42 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef CONTROLLER_H_
+#define CONTROLLER_H_
+
+#include <zephyr.h>
+#include <bluetooth/addr.h>
+
+/* ACL buffers reported to the host */
+#define CONTROLLER_ACL_MTU 251
+#define CONTROLLER_ACL_COUNT 8
+
+struct controller_stats {
+	/* ACL packets sent by the host */
+	uint32_t acl_packets;
+	/* Notifications in these packets, coalesced ones included */
+	uint32_t notifications;
+};
+
+/* Register the simulated controller as HCI driver */
+int controller_init(void);
+
+/* Report a new connection, with the local device as peripheral */
+void controller_connect(uint16_t handle, const bt_addr_le_t *peer);
+
+/* Send an ATT request from the peer of a connection and wait until the
+ * host sent the response with opcode @a rsp_op.
+ */
+int controller_att_request(uint16_t handle, const void *pdu, uint16_t len,
+			   uint8_t rsp_op, k_timeout_t timeout);
+
+/* Reset the counters and wait until @a count notifications were sent */
+void controller_expect(uint32_t count);
+int controller_wait(k_timeout_t timeout);
+
+void controller_stats_get(struct controller_stats *stats);
+
+#endif /* CONTROLLER_H_ */
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * GATT notification fan-out benchmark. The host runs on a simulated
+ * controller with CONFIG_BT_MAX_CONN peers connected, each one having
+ * exchanged a large ATT MTU and enabled notifications of all the
+ * characteristics of a sensor service. Every update notifies all the
+ * characteristics to all the peers, with one bt_gatt_notify_cb() call per
+ * characteristic and with a single bt_gatt_notify_fanout() call. An update
+ * is complete when all its notifications reached the controller.
+ *
+ * With CONFIG_BT_GATT_NOTIFY_MULTIPLE the peers also enable multiple handle
+ * value notifications, which lets the host coalesce them. With
+ * CONFIG_BT_CONN_TX_STATS the transmit statistics of the connections are
+ * reported as well, the spread of the packets sent shows how fairly the
+ * controller buffers were shared.
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <timing/timing.h>
+#include <sys/byteorder.h>
+#include <bluetooth/bluetooth.h>
+#include <bluetooth/conn.h>
+#include <bluetooth/gatt.h>
+#include <bluetooth/uuid.h>
+
+#include "controller.h"
+
+#define NUM_CONN CONFIG_BT_MAX_CONN
+#define NUM_CHRC 4
+#define N_UPDATES 100
+#define VALUE_LEN 8
+
+#define ATT_OP_MTU_REQ 0x02
+#define ATT_OP_MTU_RSP 0x03
+#define ATT_MTU 247
+
+#define CF_BIT_NOTIFY_MULTI 2
+
+#define FORMAT "%-60s:%8u cycles , %8u ns\n"
+
+static uint8_t values[NUM_CHRC][VALUE_LEN];
+
+static ssize_t read_value(struct bt_conn *conn,
+			  const struct bt_gatt_attr *attr, void *buf,
+			  uint16_t len, uint16_t offset)
+{
+	return bt_gatt_attr_read(conn, attr, buf, len, offset, attr->user_data,
+				 VALUE_LEN);
+}
+
+#define SENSOR_CHRC(_n)							\
+	BT_GATT_CHARACTERISTIC(BT_UUID_DECLARE_16(0xfff1 + (_n)),	\
+			       BT_GATT_CHRC_READ | BT_GATT_CHRC_NOTIFY,	\
+			       BT_GATT_PERM_READ, read_value, NULL,	\
+			       values[_n]),				\
+	BT_GATT_CCC(NULL, BT_GATT_PERM_READ | BT_GATT_PERM_WRITE)
+
+BT_GATT_SERVICE_DEFINE(sensor_svc,
+	BT_GATT_PRIMARY_SERVICE(BT_UUID_DECLARE_16(0xfff0)),
+	SENSOR_CHRC(0),
+	SENSOR_CHRC(1),
+	SENSOR_CHRC(2),
+	SENSOR_CHRC(3),
+);
+
+/* Each characteristic is a declaration, a value and a CCC descriptor */
+#define VALUE_ATTR(_n) (&sensor_svc.attrs[2 + 3 * (_n)])
+#define CCC_ATTR(_n) (&sensor_svc.attrs[3 + 3 * (_n)])
+
+static struct bt_gatt_notify_params params[NUM_CHRC];
+
+static struct bt_conn *conns[NUM_CONN];
+static struct bt_conn *new_conn;
+static K_SEM_DEFINE(connected_sem, 0, 1);
+
+static void connected(struct bt_conn *conn, uint8_t err)
+{
+	if (!err) {
+		new_conn = bt_conn_ref(conn);
+		k_sem_give(&connected_sem);
+	}
+}
+
+static struct bt_conn_cb conn_callbacks = {
+	.connected = connected,
+};
+
+static uint8_t find_attr(const struct bt_gatt_attr *attr, uint16_t handle,
+			 void *user_data)
+{
+	const struct bt_gatt_attr **found = user_data;
+
+	*found = attr;
+
+	return BT_GATT_ITER_STOP;
+}
+
+/* Do what a central would do when it connects to a sensor */
+static int subscribe(struct bt_conn *conn, uint16_t handle)
+{
+	uint8_t mtu_req[] = { ATT_OP_MTU_REQ, ATT_MTU & 0xff, ATT_MTU >> 8 };
+	uint16_t ccc = sys_cpu_to_le16(BT_GATT_CCC_NOTIFY);
+	int err;
+
+	err = controller_att_request(handle, mtu_req, sizeof(mtu_req),
+				     ATT_OP_MTU_RSP, K_SECONDS(1));
+	if (err) {
+		printk("MTU exchange failed (err %d)\n", err);
+		return err;
+	}
+
+	if (IS_ENABLED(CONFIG_BT_GATT_NOTIFY_MULTIPLE)) {
+		const struct bt_gatt_attr *cf = NULL;
+		uint8_t bits = BIT(CF_BIT_NOTIFY_MULTI);
+
+		bt_gatt_foreach_attr_type(0x0001, 0xffff,
+					  BT_UUID_GATT_CLIENT_FEATURES, NULL,
+					  1, find_attr, &cf);
+		if (!cf ||
+		    cf->write(conn, cf, &bits, sizeof(bits), 0, 0) < 0) {
+			printk("Enabling multiple notifications failed\n");
+			return -EIO;
+		}
+	}
+
+	for (int i = 0; i < NUM_CHRC; i++) {
+		if (bt_gatt_attr_write_ccc(conn, CCC_ATTR(i), &ccc, sizeof(ccc),
+					   0, 0) < 0) {
+			printk("Enabling notifications failed\n");
+			return -EIO;
+		}
+	}
+
+	return 0;
+}
+
+static int connect_all(void)
+{
+	int err;
+
+	bt_conn_cb_register(&conn_callbacks);
+
+	for (uint16_t i = 0; i < NUM_CONN; i++) {
+		bt_addr_le_t peer = {
+			.type = BT_ADDR_LE_RANDOM,
+			.a.val = { i + 1, 0x00, 0x00, 0x00, 0x00, 0xc0 },
+		};
+		uint16_t handle = i + 1;
+
+		/* Advertising is resumed after each connection when the
+		 * controller allows it, otherwise start it again.
+		 */
+		err = bt_le_adv_start(BT_LE_ADV_CONN, NULL, 0, NULL, 0);
+		if (err && err != -EALREADY) {
+			printk("Advertising failed to start (err %d)\n", err);
+			return err;
+		}
+
+		controller_connect(handle, &peer);
+
+		err = k_sem_take(&connected_sem, K_SECONDS(1));
+		if (err) {
+			printk("Connection %u failed\n", i);
+			return err;
+		}
+
+		conns[i] = new_conn;
+
+		err = subscribe(conns[i], handle);
+		if (err) {
+			return err;
+		}
+	}
+
+	return bt_le_adv_stop();
+}
+
+static void update_values(uint32_t update)
+{
+	for (int i = 0; i < NUM_CHRC; i++) {
+		sys_put_le32(update, values[i]);
+	}
+}
+
+static int notify_each(void)
+{
+	int err;
+
+	for (int i = 0; i < NUM_CHRC; i++) {
+		err = bt_gatt_notify_cb(NULL, &params[i]);
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+static int notify_fanout(void)
+{
+	return bt_gatt_notify_fanout(NUM_CHRC, params);
+}
+
+static void report_tx_stats(const char *name)
+{
+	uint32_t sent_min = UINT32_MAX, sent_max = 0U;
+	uint32_t max_queued = 0U, max_in_flight = 0U, stalls = 0U;
+
+	for (int i = 0; i < NUM_CONN; i++) {
+		struct bt_conn_tx_stats stats;
+
+		if (bt_conn_tx_stats_get(conns[i], &stats)) {
+			return;
+		}
+
+		sent_min = MIN(sent_min, stats.sent);
+		sent_max = MAX(sent_max, stats.sent);
+		max_queued = MAX(max_queued, stats.max_queued);
+		max_in_flight = MAX(max_in_flight, stats.max_in_flight);
+		stalls += stats.credit_stalls;
+	}
+
+	printk("%-60s:%8u..%u packets sent per peer\n", name, sent_min,
+	       sent_max);
+	printk("%-60s:%8u max queued, %u max in flight\n", name, max_queued,
+	       max_in_flight);
+	printk("%-60s:%8u credit stalls\n", name, stalls);
+}
+
+static int bench(const char *api, int (*notify)(void))
+{
+	struct controller_stats stats;
+	timing_t start, end;
+	uint64_t cycles, ns;
+	char name[64];
+	int err;
+
+	controller_expect(N_UPDATES * NUM_CHRC * NUM_CONN);
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < N_UPDATES; i++) {
+		update_values(i);
+
+		err = notify();
+		if (err) {
+			printk("%s failed (err %d)\n", api, err);
+			return err;
+		}
+	}
+
+	err = controller_wait(K_SECONDS(10));
+	end = timing_counter_get();
+
+	controller_stats_get(&stats);
+	if (err) {
+		printk("%s: %u of %u notifications sent\n", api,
+		       stats.notifications, N_UPDATES * NUM_CHRC * NUM_CONN);
+		return err;
+	}
+
+	cycles = timing_cycles_get(&start, &end);
+	ns = timing_cycles_to_ns(cycles);
+
+	snprintk(name, sizeof(name), "%s update, %d peers", api, NUM_CONN);
+	printk(FORMAT, name, (uint32_t)(cycles / N_UPDATES),
+	       (uint32_t)timing_cycles_to_ns_avg(cycles, N_UPDATES));
+	printk("%-60s:%8u notifications/s\n", name,
+	       (uint32_t)((ns != 0U) ? ((uint64_t)stats.notifications *
+					NSEC_PER_SEC) / ns : 0U));
+	printk("%-60s:%8u ACL packets\n", name, stats.acl_packets);
+
+	if (IS_ENABLED(CONFIG_BT_CONN_TX_STATS)) {
+		report_tx_stats(name);
+	}
+
+	return 0;
+}
+
+void main(void)
+{
+	int err;
+
+	for (int i = 0; i < NUM_CHRC; i++) {
+		params[i].attr = VALUE_ATTR(i);
+		params[i].data = values[i];
+		params[i].len = VALUE_LEN;
+	}
+
+	err = controller_init();
+	if (!err) {
+		err = bt_enable(NULL);
+	}
+
+	if (err) {
+		printk("Bluetooth init failed (err %d)\n", err);
+		return;
+	}
+
+	if (connect_all()) {
+		return;
+	}
+
+	timing_init();
+	timing_start();
+
+	if (bench("bt_gatt_notify_cb", notify_each) ||
+	    bench("bt_gatt_notify_fanout", notify_fanout)) {
+		timing_stop();
+		return;
+	}
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
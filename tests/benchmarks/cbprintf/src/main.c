@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Measures the cost of the steps a deferred log message goes through:
+ * building the package (with the format scanned at runtime, with an argument
+ * descriptor generated at build time and fully static) and formatting the
+ * package into a discarding output.
+ */
+
+#include <zephyr.h>
+#include <sys/cbprintf.h>
+#include <timing/timing.h>
+
+#define N_RUNS 1000
+
+#define FORMAT "%-60s:%8u cycles , %8u ns\n"
+
+static uint8_t __aligned(CBPRINTF_PACKAGE_ALIGNMENT) package[128];
+
+static int discard(int c, void *ctx)
+{
+	ARG_UNUSED(ctx);
+
+	return c;
+}
+
+static void report(const char *name, uint64_t cycles)
+{
+	uint32_t avg = (uint32_t)(cycles / N_RUNS);
+
+	printk(FORMAT, name, avg,
+	       (uint32_t)timing_cycles_to_ns_avg(cycles, N_RUNS));
+}
+
+#define BENCH(name, ...) do { \
+	timing_t start, end; \
+	uint64_t rt = 0, desc = 0, fmt = 0; \
+	int len; \
+	for (int i = 0; i < N_RUNS; i++) { \
+		start = timing_counter_get(); \
+		len = cbprintf_package(package, sizeof(package), \
+				       __VA_ARGS__); \
+		end = timing_counter_get(); \
+		rt += timing_cycles_get(&start, &end); \
+		start = timing_counter_get(); \
+		len = CBPRINTF_PACKAGE_DESC(package, sizeof(package), \
+					    __VA_ARGS__); \
+		end = timing_counter_get(); \
+		desc += timing_cycles_get(&start, &end); \
+		start = timing_counter_get(); \
+		cbpprintf(discard, NULL, package); \
+		end = timing_counter_get(); \
+		fmt += timing_cycles_get(&start, &end); \
+	} \
+	if (len <= 0) { \
+		printk("%s: packaging failed (err %d)\n", name, len); \
+		return; \
+	} \
+	report(name " package (runtime)", rt); \
+	report(name " package (descriptor)", desc); \
+	report(name " format", fmt); \
+} while (0)
+
+#define BENCH_STATIC(name, ...) do { \
+	timing_t start, end; \
+	uint64_t st = 0; \
+	int len; \
+	for (int i = 0; i < N_RUNS; i++) { \
+		start = timing_counter_get(); \
+		CBPRINTF_STATIC_PACKAGE(package, sizeof(package), len, 0, \
+					__VA_ARGS__); \
+		end = timing_counter_get(); \
+		st += timing_cycles_get(&start, &end); \
+	} \
+	if (len <= 0) { \
+		printk("%s: static packaging failed (err %d)\n", name, len); \
+		return; \
+	} \
+	report(name " package (static)", st); \
+} while (0)
+
+void main(void)
+{
+	volatile int val = 1234;
+	volatile uint32_t addr = 0x20001000;
+	volatile long long ts = 1234567890123LL;
+	char name[] = "temp";
+
+	timing_init();
+	timing_start();
+
+	BENCH_STATIC("int", "val %d", val);
+	BENCH("int", "val %d", val);
+	BENCH_STATIC("hex/unsigned", "addr 0x%08x len %u", addr, val);
+	BENCH("hex/unsigned", "addr 0x%08x len %u", addr, val);
+	BENCH_STATIC("long long", "ts %lld ev %d", ts, val);
+	BENCH("long long", "ts %lld ev %d", ts, val);
+	BENCH("string", "sensor %s: %d.%06d", name, val, val);
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
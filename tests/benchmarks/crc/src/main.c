@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * CRC throughput benchmark. Each algorithm is run over the same buffer and
+ * the average cost of processing one KiB is reported. Build with the
+ * different CRC_IMPLEMENTATION choices and CRC_HW_ACCEL to compare.
+ */
+
+#include <zephyr.h>
+#include <sys/crc.h>
+#include <timing/timing.h>
+
+#define BUF_SIZE 4096
+#define N_RUNS 16
+
+#define FORMAT "%-60s:%8u cycles , %8u ns\n"
+
+static uint8_t buf[BUF_SIZE];
+static volatile uint32_t sink;
+
+static void report(const char *name, uint64_t cycles)
+{
+	uint32_t kib = N_RUNS * BUF_SIZE / 1024;
+
+	printk(FORMAT, name, (uint32_t)(cycles / kib),
+	       (uint32_t)timing_cycles_to_ns_avg(cycles, kib));
+}
+
+#define BENCH(name, expr) do { \
+	timing_t start, end; \
+	uint64_t cycles = 0; \
+	for (int i = 0; i < N_RUNS; i++) { \
+		start = timing_counter_get(); \
+		sink = (expr); \
+		end = timing_counter_get(); \
+		cycles += timing_cycles_get(&start, &end); \
+	} \
+	report(name " per KiB", cycles); \
+} while (0)
+
+void main(void)
+{
+	for (int i = 0; i < BUF_SIZE; i++) {
+		buf[i] = (uint8_t)(i * 7 + 3);
+	}
+
+	timing_init();
+	timing_start();
+
+	printk("CRC implementation: %s%s\n",
+	       IS_ENABLED(CONFIG_CRC_FAST_TABLES) ? "fast tables" :
+						    "small tables",
+	       IS_ENABLED(CONFIG_CRC_HW_ACCEL) ? ", hw accel" : "");
+
+	BENCH("crc32_ieee", crc32_ieee(buf, BUF_SIZE));
+	BENCH("crc32_c", crc32_c(0, buf, BUF_SIZE, true, true));
+	BENCH("crc16_ccitt", crc16_ccitt(0xffff, buf, BUF_SIZE));
+	BENCH("crc16_itu_t", crc16_itu_t(0, buf, BUF_SIZE));
+	BENCH("crc16_ansi", crc16_ansi(buf, BUF_SIZE));
+	BENCH("crc8_ccitt", crc8_ccitt(CRC8_CCITT_INITIAL_VALUE, buf, BUF_SIZE));
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
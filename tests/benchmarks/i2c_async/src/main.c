@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * I2C transaction benchmark, on the emulated I2C controller with an AT24
+ * EEPROM emulator. Register reads (a write of the register address followed
+ * by a read) are done with i2c_write_read(), which blocks the caller for
+ * each transaction, and queued in batches with i2c_transfer_async(), where
+ * the caller only waits for the last transaction of a batch. For the latter
+ * the time the caller spends queueing is reported on its own, it is what a
+ * driver pays while the bus works in the background.
+ */
+
+#include <zephyr.h>
+#include <timing/timing.h>
+#include <drivers/i2c.h>
+
+#define EEPROM_NODE DT_NODELABEL(bench_eeprom)
+#define EEPROM_ADDR DT_REG_ADDR(EEPROM_NODE)
+
+#define N_TRANSACTIONS 1024
+#define BATCH 16
+#define READ_LEN 16
+
+#define FORMAT "%-60s:%8u cycles , %8u ns\n"
+#define OPS_FORMAT "%-60s:%8u transactions/s\n"
+
+static const struct device *bus;
+
+struct read_txn {
+	struct i2c_txn txn;
+	struct i2c_msg msgs[2];
+	uint8_t reg;
+	uint8_t data[READ_LEN];
+};
+
+static struct read_txn batch[BATCH];
+static struct k_poll_signal batch_done;
+static volatile int failed;
+
+static void report(const char *name, uint32_t ops, uint64_t cycles,
+		   bool rate)
+{
+	uint64_t ns = timing_cycles_to_ns(cycles);
+
+	printk(FORMAT, name, (uint32_t)(cycles / ops),
+	       (uint32_t)timing_cycles_to_ns_avg(cycles, ops));
+	if (rate) {
+		printk(OPS_FORMAT, name,
+		       (uint32_t)((ns != 0U) ?
+				  ((uint64_t)ops * NSEC_PER_SEC) / ns : 0U));
+	}
+}
+
+static int bench_sync(void)
+{
+	uint8_t data[READ_LEN];
+	timing_t start, end;
+	int err;
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < N_TRANSACTIONS; i++) {
+		uint8_t reg = (i * READ_LEN) & 0xff;
+
+		err = i2c_write_read(bus, EEPROM_ADDR, &reg, sizeof(reg),
+				     data, sizeof(data));
+		if (err) {
+			printk("i2c_write_read failed (err %d)\n", err);
+			return err;
+		}
+	}
+	end = timing_counter_get();
+
+	report("i2c_write_read, register read", N_TRANSACTIONS,
+	       timing_cycles_get(&start, &end), true);
+
+	return 0;
+}
+
+static void txn_done(const struct device *dev, int result, void *user_data)
+{
+	if (result) {
+		failed = result;
+	}
+}
+
+static void prepare_batch(void)
+{
+	for (int i = 0; i < BATCH; i++) {
+		struct read_txn *r = &batch[i];
+
+		r->msgs[0].buf = &r->reg;
+		r->msgs[0].len = sizeof(r->reg);
+		r->msgs[0].flags = I2C_MSG_WRITE;
+		r->msgs[1].buf = r->data;
+		r->msgs[1].len = sizeof(r->data);
+		r->msgs[1].flags = I2C_MSG_RESTART | I2C_MSG_READ |
+				   I2C_MSG_STOP;
+
+		r->txn.msgs = r->msgs;
+		r->txn.num_msgs = ARRAY_SIZE(r->msgs);
+		r->txn.addr = EEPROM_ADDR;
+		r->txn.cb = txn_done;
+		r->txn.signal = NULL;
+		r->reg = (i * READ_LEN) & 0xff;
+	}
+
+	/* Only the last transaction of a batch is waited for */
+	batch[BATCH - 1].txn.signal = &batch_done;
+}
+
+static int bench_async(void)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_SIGNAL, K_POLL_MODE_NOTIFY_ONLY, &batch_done);
+	uint64_t queue_cycles = 0U;
+	timing_t start, end, queued;
+	int err;
+
+	k_poll_signal_init(&batch_done);
+	prepare_batch();
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < N_TRANSACTIONS / BATCH; i++) {
+		timing_t batch_start = timing_counter_get();
+
+		for (int j = 0; j < BATCH; j++) {
+			err = i2c_transfer_async(bus, &batch[j].txn);
+			if (err) {
+				printk("i2c_transfer_async failed (err %d)\n",
+				       err);
+				return err;
+			}
+		}
+
+		queued = timing_counter_get();
+		queue_cycles += timing_cycles_get(&batch_start, &queued);
+
+		err = k_poll(&event, 1, K_SECONDS(1));
+		if (err || failed) {
+			printk("Batch %u failed (err %d)\n", i,
+			       err ? err : failed);
+			return -EIO;
+		}
+
+		event.state = K_POLL_STATE_NOT_READY;
+		k_poll_signal_reset(&batch_done);
+	}
+	end = timing_counter_get();
+
+	report("i2c_transfer_async, register read, batches of 16",
+	       N_TRANSACTIONS, timing_cycles_get(&start, &end), true);
+	report("i2c_transfer_async, caller time per transaction",
+	       N_TRANSACTIONS, queue_cycles, false);
+
+	return 0;
+}
+
+void main(void)
+{
+	bus = DEVICE_DT_GET(DT_BUS(EEPROM_NODE));
+	if (!device_is_ready(bus)) {
+		printk("I2C controller not ready\n");
+		return;
+	}
+
+	timing_init();
+	timing_start();
+
+	if (bench_sync() || bench_async()) {
+		timing_stop();
+		return;
+	}
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <app_memory/app_memdomain.h>
+#include "utils.h"
+
+/* the number of system calls measured */
+#define N_TEST_SYSCALL 1000
+
+/* dynamic objects allocated besides the measured one */
+#define N_DYN_OBJS 64
+
+#define USER_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+#ifdef CONFIG_USERSPACE
+static K_SEM_DEFINE(static_sem, 0, N_TEST_SYSCALL);
+
+K_THREAD_STACK_DEFINE(kobj_user_stack, USER_STACK_SIZE);
+static struct k_thread kobj_user_thread;
+
+/* written by the user thread, so it must be mapped */
+K_APPMEM_PARTITION_DEFINE(bench_kobj_part);
+static K_APP_BMEM(bench_kobj_part) uint32_t syscall_cycles;
+
+/*
+ * Give the semaphore N_TEST_SYSCALL times from user mode. Every call
+ * validates the semaphore, which for a dynamic object means looking it up
+ * at run time. k_cycle_get_32() is used since the timing API counters may
+ * not be readable from user mode; its overhead is amortized over the loop.
+ */
+static void kobj_user_loop(void *p1, void *p2, void *p3)
+{
+	struct k_sem *sem = p1;
+	uint32_t start;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < N_TEST_SYSCALL; i++) {
+		k_sem_give(sem);
+	}
+	syscall_cycles = k_cycle_get_32() - start;
+}
+
+static void kobj_syscall_measure(struct k_sem *sem, const char *kind)
+{
+	char label[61];
+	k_tid_t tid;
+
+	k_sem_init(sem, 0, N_TEST_SYSCALL);
+
+	tid = k_thread_create(&kobj_user_thread, kobj_user_stack,
+			      USER_STACK_SIZE, kobj_user_loop, sem, NULL, NULL,
+			      K_PRIO_PREEMPT(9), K_USER, K_FOREVER);
+	k_object_access_grant(sem, tid);
+	k_thread_start(tid);
+	k_thread_join(tid, K_FOREVER);
+
+	snprintk(label, sizeof(label),
+		 "Average time of k_sem_give() from user mode (%s)", kind);
+	PRINT_F(label, syscall_cycles / N_TEST_SYSCALL,
+		(uint32_t)(k_cyc_to_ns_floor64(syscall_cycles) /
+			   N_TEST_SYSCALL));
+}
+#endif /* CONFIG_USERSPACE */
+
+/**
+ *
+ * @brief Test for the system call overhead on kernel objects
+ *
+ * The routine measures a system call from user mode on a statically
+ * defined semaphore and, when CONFIG_DYNAMIC_OBJECTS is enabled, on a
+ * semaphore allocated at run time among N_DYN_OBJS other dynamic objects.
+ *
+ * @return 0 on success
+ */
+int kobject_syscall(void)
+{
+#ifdef CONFIG_USERSPACE
+	int ret;
+
+	ret = k_mem_domain_add_partition(&k_mem_domain_default,
+					 &bench_kobj_part);
+	if (ret != 0) {
+		printk(" Error: failed to add partition (%d)\n", ret);
+		error_count++;
+		return ret;
+	}
+
+	kobj_syscall_measure(&static_sem, "static");
+
+#ifdef CONFIG_DYNAMIC_OBJECTS
+	void *objs[N_DYN_OBJS];
+	struct k_sem *dyn_sem;
+
+	k_thread_system_pool_assign(k_current_get());
+
+	for (int i = 0; i < N_DYN_OBJS; i++) {
+		objs[i] = k_object_alloc(K_OBJ_SEM);
+		if (objs[i] == NULL) {
+			printk(" Error: failed to allocate object %d\n", i);
+			error_count++;
+			return -ENOMEM;
+		}
+	}
+
+	dyn_sem = k_object_alloc(K_OBJ_SEM);
+	if (dyn_sem == NULL) {
+		printk(" Error: failed to allocate object\n");
+		error_count++;
+		return -ENOMEM;
+	}
+
+	kobj_syscall_measure(dyn_sem, "dynamic");
+
+	k_object_free(dyn_sem);
+	for (int i = 0; i < N_DYN_OBJS; i++) {
+		k_object_free(objs[i]);
+	}
+#endif /* CONFIG_DYNAMIC_OBJECTS */
+#endif /* CONFIG_USERSPACE */
+
+	return 0;
+}
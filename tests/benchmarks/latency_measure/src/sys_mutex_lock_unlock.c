@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/mutex.h>
+#include <app_memory/app_memdomain.h>
+#include "utils.h"
+
+/* the number of sys_mutex lock/unlock cycles */
+#define N_TEST_SYS_MUTEX 1000
+
+#define USER_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+#ifdef CONFIG_USERSPACE
+K_APPMEM_PARTITION_DEFINE(bench_sys_mutex_part);
+#define BENCH_BMEM K_APP_BMEM(bench_sys_mutex_part)
+#else
+#define BENCH_BMEM
+#endif
+
+/* user threads operate on the mutex word directly, so it must be mapped */
+static BENCH_BMEM SYS_MUTEX_DEFINE(test_sys_mutex);
+
+static BENCH_BMEM uint32_t lock_cycles;
+static BENCH_BMEM uint32_t unlock_cycles;
+
+/*
+ * Lock the mutex N_TEST_SYS_MUTEX times recursively, then unlock it as many
+ * times. k_cycle_get_32() is used since the timing API counters may not be
+ * readable from user mode; its overhead is amortized over the loop.
+ */
+static void sys_mutex_loop(void *p1, void *p2, void *p3)
+{
+	uint32_t start;
+	int i;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	start = k_cycle_get_32();
+	for (i = 0; i < N_TEST_SYS_MUTEX; i++) {
+		sys_mutex_lock(&test_sys_mutex, K_FOREVER);
+	}
+	lock_cycles = k_cycle_get_32() - start;
+
+	start = k_cycle_get_32();
+	for (i = 0; i < N_TEST_SYS_MUTEX; i++) {
+		sys_mutex_unlock(&test_sys_mutex);
+	}
+	unlock_cycles = k_cycle_get_32() - start;
+}
+
+static void print_sys_mutex_stats(const char *ctx)
+{
+	char label[61];
+
+	snprintk(label, sizeof(label), "Average time to lock a sys_mutex (%s)",
+		 ctx);
+	PRINT_F(label, lock_cycles / N_TEST_SYS_MUTEX,
+		(uint32_t)(k_cyc_to_ns_floor64(lock_cycles) /
+			   N_TEST_SYS_MUTEX));
+
+	snprintk(label, sizeof(label),
+		 "Average time to unlock a sys_mutex (%s)", ctx);
+	PRINT_F(label, unlock_cycles / N_TEST_SYS_MUTEX,
+		(uint32_t)(k_cyc_to_ns_floor64(unlock_cycles) /
+			   N_TEST_SYS_MUTEX));
+}
+
+#ifdef CONFIG_USERSPACE
+K_THREAD_STACK_DEFINE(user_stack, USER_STACK_SIZE);
+static struct k_thread user_thread;
+#endif
+
+/**
+ *
+ * @brief Test for the multiple sys_mutex lock/unlock time
+ *
+ * The routine measures uncontended sys_mutex lock and unlock times from
+ * supervisor mode and, when CONFIG_USERSPACE is enabled, from a user mode
+ * thread where CONFIG_SYS_MUTEX_FAST_PATH, which needs thread local
+ * storage, avoids the system calls.
+ *
+ * @return 0 on success
+ */
+int sys_mutex_lock_unlock(void)
+{
+	sys_mutex_loop(NULL, NULL, NULL);
+	print_sys_mutex_stats("supervisor");
+
+#ifdef CONFIG_USERSPACE
+	k_tid_t tid;
+	int ret;
+
+	ret = k_mem_domain_add_partition(&k_mem_domain_default,
+					 &bench_sys_mutex_part);
+	if (ret != 0) {
+		printk(" Error: failed to add partition (%d)\n", ret);
+		error_count++;
+		return ret;
+	}
+
+	tid = k_thread_create(&user_thread, user_stack, USER_STACK_SIZE,
+			      sys_mutex_loop, NULL, NULL, NULL,
+			      K_PRIO_PREEMPT(9), K_USER | K_INHERIT_PERMS,
+			      K_FOREVER);
+	k_object_access_grant(&test_sys_mutex, tid);
+	k_thread_start(tid);
+	k_thread_join(tid, K_FOREVER);
+
+	print_sys_mutex_stats("user");
+#endif
+
+	return 0;
+}
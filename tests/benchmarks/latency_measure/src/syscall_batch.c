@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <sys/syscall_batch.h>
+#include <app_memory/app_memdomain.h>
+#include "utils.h"
+
+/* the number of iterations of the measured sequence */
+#define N_TEST_BATCH 500
+
+#define USER_STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+#ifdef CONFIG_SYSCALL_BATCH
+static K_SEM_DEFINE(batch_sem, 0, N_TEST_BATCH);
+K_MSGQ_DEFINE(batch_msgq, sizeof(uint32_t), N_TEST_BATCH, 4);
+#ifdef CONFIG_POLL
+static struct k_poll_signal batch_signal;
+#endif
+
+K_THREAD_STACK_DEFINE(batch_user_stack, USER_STACK_SIZE);
+static struct k_thread batch_user_thread;
+
+/* written by the user thread, so it must be mapped */
+K_APPMEM_PARTITION_DEFINE(bench_batch_part);
+static K_APP_BMEM(bench_batch_part) uint32_t batch_cycles;
+
+/* The same sequence issued as individual system calls */
+static void single_loop(void *p1, void *p2, void *p3)
+{
+	uint32_t data = 0U;
+	uint32_t start;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < N_TEST_BATCH; i++) {
+		k_sem_give(&batch_sem);
+		(void)k_msgq_put(&batch_msgq, &data, K_NO_WAIT);
+#ifdef CONFIG_POLL
+		(void)k_poll_signal_raise(&batch_signal, 1);
+#endif
+	}
+	batch_cycles = k_cycle_get_32() - start;
+}
+
+/* The same sequence issued as one batch per iteration */
+static void batch_loop(void *p1, void *p2, void *p3)
+{
+	uint32_t data = 0U;
+	struct k_syscall_op ops[] = {
+		K_SYSCALL_OP(K_SYSCALL_K_SEM_GIVE, (uintptr_t)&batch_sem),
+		K_SYSCALL_OP(K_SYSCALL_K_MSGQ_PUT, (uintptr_t)&batch_msgq,
+			     (uintptr_t)&data, K_SYSCALL_OP_TIMEOUT(K_NO_WAIT)),
+#ifdef CONFIG_POLL
+		K_SYSCALL_OP(K_SYSCALL_K_POLL_SIGNAL_RAISE,
+			     (uintptr_t)&batch_signal, 1),
+#endif
+	};
+	uint32_t start;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	start = k_cycle_get_32();
+	for (int i = 0; i < N_TEST_BATCH; i++) {
+		(void)k_syscall_batch(ops, ARRAY_SIZE(ops));
+	}
+	batch_cycles = k_cycle_get_32() - start;
+}
+
+static void batch_measure(k_thread_entry_t entry, const char *kind)
+{
+	char label[61];
+	k_tid_t tid;
+
+	k_sem_reset(&batch_sem);
+	k_msgq_purge(&batch_msgq);
+
+	tid = k_thread_create(&batch_user_thread, batch_user_stack,
+			      USER_STACK_SIZE, entry, NULL, NULL, NULL,
+			      K_PRIO_PREEMPT(9), K_USER, K_FOREVER);
+	k_object_access_grant(&batch_sem, tid);
+	k_object_access_grant(&batch_msgq, tid);
+#ifdef CONFIG_POLL
+	k_object_access_grant(&batch_signal, tid);
+#endif
+	k_thread_start(tid);
+	k_thread_join(tid, K_FOREVER);
+
+	snprintk(label, sizeof(label), "Average time of a %s", kind);
+	PRINT_F(label, batch_cycles / N_TEST_BATCH,
+		(uint32_t)(k_cyc_to_ns_floor64(batch_cycles) / N_TEST_BATCH));
+}
+#endif /* CONFIG_SYSCALL_BATCH */
+
+/**
+ *
+ * @brief Test for the system call batching overhead
+ *
+ * The routine measures, from a user mode thread, a sequence of a semaphore
+ * give, a message queue put and, when CONFIG_POLL is enabled, a poll signal
+ * raise, issued as individual system calls and as a single batch.
+ *
+ * @return 0 on success
+ */
+int syscall_batch(void)
+{
+#ifdef CONFIG_SYSCALL_BATCH
+	int ret;
+
+	ret = k_mem_domain_add_partition(&k_mem_domain_default,
+					 &bench_batch_part);
+	if (ret != 0) {
+		printk(" Error: failed to add partition (%d)\n", ret);
+		error_count++;
+		return ret;
+	}
+
+#ifdef CONFIG_POLL
+	k_poll_signal_init(&batch_signal);
+#endif
+
+	batch_measure(single_loop, "sequence of individual syscalls (user)");
+	batch_measure(batch_loop, "batch of the same syscalls (user)");
+#endif
+
+	return 0;
+}
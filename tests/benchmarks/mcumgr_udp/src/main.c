@@ -0,0 +1,303 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * mcumgr upload benchmark over the SMP UDP transport. A client socket
+ * uploads an IMAGE_LEN bytes image to the local SMP server, over the
+ * loopback interface, in CHUNK_LEN bytes chunks. The server side is an
+ * upload command written like the image management one: chunks are
+ * accepted at the expected offset only and written to flash with
+ * stream_flash, erasing pages as the upload progresses.
+ *
+ * The client keeps up to CONFIG_MCUMGR_SMP_WINDOW chunks in flight. With a
+ * window of one this is the stop-and-wait upload, with a larger one and
+ * CONFIG_MCUMGR_SMP_WORKQUEUE the flash writes overlap with the reception
+ * of the next chunks.
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <timing/timing.h>
+#include <sys/byteorder.h>
+#include <drivers/flash.h>
+#include <storage/flash_map.h>
+#include <storage/stream_flash.h>
+#include <net/socket.h>
+#include <mgmt/mgmt.h>
+#include <mgmt/mcumgr/smp_udp.h>
+#include <cborattr/cborattr.h>
+
+#define IMAGE_LEN (512 * 1024)
+#define CHUNK_LEN 1024
+#define N_CHUNKS (IMAGE_LEN / CHUNK_LEN)
+#define WINDOW CONFIG_MCUMGR_SMP_WINDOW
+
+#define BENCH_MGMT_ID_UPLOAD 0
+
+/* {"off": uint32, "data": bstr16} */
+#define CBOR_HDR_LEN (1 + 4 + 5 + 5 + 3)
+#define REQ_LEN (MGMT_HDR_SIZE + CBOR_HDR_LEN + CHUNK_LEN)
+
+#define FORMAT "%-60s:%8u cycles , %8u ns\n"
+
+static const struct flash_area *fa;
+static struct stream_flash_ctx stream;
+static uint8_t stream_buf[512];
+static uint8_t chunk[CHUNK_LEN];
+
+static uint8_t image_byte(size_t off)
+{
+	return (uint8_t)(off * 7U + (off >> 10));
+}
+
+static int bench_mgmt_upload(struct mgmt_ctxt *ctxt)
+{
+	unsigned long long off = UINT64_MAX;
+	size_t data_len = 0;
+	size_t written;
+	const struct cbor_attr_t attrs[] = {
+		{
+			.attribute = "off",
+			.type = CborAttrUnsignedIntegerType,
+			.addr.uinteger = &off,
+			.nodefault = true,
+		},
+		{
+			.attribute = "data",
+			.type = CborAttrByteStringType,
+			.addr.bytestring.data = chunk,
+			.addr.bytestring.len = &data_len,
+			.len = sizeof(chunk),
+		},
+		{ 0 },
+	};
+	CborError err;
+
+	if (cbor_read_object(&ctxt->it, attrs) != 0) {
+		return MGMT_ERR_EINVAL;
+	}
+
+	/* Other chunks are answered with the expected offset */
+	written = stream_flash_bytes_written(&stream);
+	if (off == written) {
+		if (stream_flash_buffered_write(&stream, chunk, data_len,
+						off + data_len == IMAGE_LEN)) {
+			return MGMT_ERR_EUNKNOWN;
+		}
+		written += data_len;
+	}
+
+	err = cbor_encode_text_stringz(&ctxt->encoder, "rc");
+	err |= cbor_encode_int(&ctxt->encoder, MGMT_ERR_EOK);
+	err |= cbor_encode_text_stringz(&ctxt->encoder, "off");
+	err |= cbor_encode_uint(&ctxt->encoder, written);
+
+	return (err != CborNoError) ? MGMT_ERR_ENOMEM : MGMT_ERR_EOK;
+}
+
+static const struct mgmt_handler bench_mgmt_handlers[] = {
+	[BENCH_MGMT_ID_UPLOAD] = {
+		.mh_read = NULL,
+		.mh_write = bench_mgmt_upload,
+	},
+};
+
+static struct mgmt_group bench_mgmt_group = {
+	.mg_handlers = bench_mgmt_handlers,
+	.mg_handlers_count = ARRAY_SIZE(bench_mgmt_handlers),
+	.mg_group_id = MGMT_GROUP_ID_PERUSER,
+};
+
+static int server_init(void)
+{
+	const struct device *dev;
+	int err;
+
+	err = flash_area_open(FLASH_AREA_ID(bench), &fa);
+	if (err) {
+		return err;
+	}
+
+	dev = device_get_binding(fa->fa_dev_name);
+	if (!dev) {
+		return -ENODEV;
+	}
+
+	err = stream_flash_init(&stream, dev, stream_buf, sizeof(stream_buf),
+				fa->fa_off, fa->fa_size, NULL);
+	if (err) {
+		return err;
+	}
+
+	if (IS_ENABLED(CONFIG_STREAM_FLASH_ERASE_AHEAD)) {
+		err = stream_flash_erase_ahead(&stream, 2);
+		if (err) {
+			return err;
+		}
+	}
+
+	mgmt_register_group(&bench_mgmt_group);
+
+	return smp_udp_open();
+}
+
+/* The SMP request and its CBOR payload, encoded by hand */
+static size_t encode_req(uint8_t *req, uint8_t seq, uint32_t off)
+{
+	uint8_t *p = req;
+
+	*p++ = MGMT_OP_WRITE;
+	*p++ = 0;
+	sys_put_be16(CBOR_HDR_LEN + CHUNK_LEN, p);
+	p += 2;
+	sys_put_be16(MGMT_GROUP_ID_PERUSER, p);
+	p += 2;
+	*p++ = seq;
+	*p++ = BENCH_MGMT_ID_UPLOAD;
+
+	/* Map of two pairs */
+	*p++ = 0xa2;
+	memcpy(p, "\x63" "off", 4);
+	p += 4;
+	*p++ = 0x1a;
+	sys_put_be32(off, p);
+	p += 4;
+	memcpy(p, "\x64" "data", 5);
+	p += 5;
+	*p++ = 0x59;
+	sys_put_be16(CHUNK_LEN, p);
+	p += 2;
+
+	for (size_t i = 0; i < CHUNK_LEN; i++) {
+		*p++ = image_byte(off + i);
+	}
+
+	return p - req;
+}
+
+static int upload(int sock, const struct sockaddr_in *server)
+{
+	static uint8_t req[REQ_LEN];
+	uint8_t rsp[64];
+	struct pollfd pfd = {
+		.fd = sock,
+		.events = POLLIN,
+	};
+	uint32_t sent = 0U;
+	uint32_t acked = 0U;
+	size_t len;
+	int ret;
+
+	while (acked < N_CHUNKS) {
+		/* Fill the window */
+		while ((sent < N_CHUNKS) && (sent - acked < WINDOW)) {
+			len = encode_req(req, (uint8_t)sent, sent * CHUNK_LEN);
+			ret = sendto(sock, req, len, 0,
+				     (const struct sockaddr *)server,
+				     sizeof(*server));
+			if (ret < 0) {
+				printk("sendto failed (err %d)\n", errno);
+				return -errno;
+			}
+			sent++;
+		}
+
+		ret = poll(&pfd, 1, 1000);
+		if (ret <= 0) {
+			printk("No response to chunk %u\n", acked);
+			return -ETIMEDOUT;
+		}
+
+		ret = recv(sock, rsp, sizeof(rsp), 0);
+		if ((ret < MGMT_HDR_SIZE) || (rsp[0] != MGMT_OP_WRITE_RSP) ||
+		    (rsp[6] != (uint8_t)acked)) {
+			printk("Unexpected response to chunk %u\n", acked);
+			return -EIO;
+		}
+
+		acked++;
+	}
+
+	return 0;
+}
+
+static int verify(void)
+{
+	for (size_t off = 0; off < IMAGE_LEN; off += CHUNK_LEN) {
+		if (flash_area_read(fa, off, chunk, CHUNK_LEN)) {
+			return -EIO;
+		}
+
+		for (size_t i = 0; i < CHUNK_LEN; i++) {
+			if (chunk[i] != image_byte(off + i)) {
+				printk("Image differs at offset %zu\n",
+				       off + i);
+				return -EIO;
+			}
+		}
+	}
+
+	return 0;
+}
+
+void main(void)
+{
+	struct sockaddr_in server = {
+		.sin_family = AF_INET,
+		.sin_port = htons(CONFIG_MCUMGR_SMP_UDP_PORT),
+	};
+	timing_t start, end;
+	uint64_t cycles, ns;
+	char name[64];
+	int sock;
+	int err;
+
+	err = server_init();
+	if (err) {
+		printk("SMP server init failed (err %d)\n", err);
+		return;
+	}
+
+	inet_pton(AF_INET, CONFIG_NET_CONFIG_MY_IPV4_ADDR, &server.sin_addr);
+
+	sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	if (sock < 0) {
+		printk("socket failed (err %d)\n", errno);
+		return;
+	}
+
+	/* Let the SMP receive thread start */
+	k_sleep(K_MSEC(100));
+
+	timing_init();
+	timing_start();
+
+	start = timing_counter_get();
+	err = upload(sock, &server);
+	end = timing_counter_get();
+
+	timing_stop();
+	close(sock);
+
+	if (err || verify()) {
+		return;
+	}
+
+	cycles = timing_cycles_get(&start, &end);
+	ns = timing_cycles_to_ns(cycles);
+
+	snprintk(name, sizeof(name), "%u KiB upload, %u B chunks, window %u",
+		 IMAGE_LEN / 1024, CHUNK_LEN, WINDOW);
+	printk(FORMAT, name, (uint32_t)(cycles / N_CHUNKS),
+	       (uint32_t)timing_cycles_to_ns_avg(cycles, N_CHUNKS));
+	printk("%-60s:%8u ms\n", name,
+	       (uint32_t)(ns / (NSEC_PER_USEC * USEC_PER_MSEC)));
+	printk("%-60s:%8u bytes/s\n", name,
+	       (uint32_t)((ns != 0U) ?
+			  ((uint64_t)IMAGE_LEN * NSEC_PER_SEC) / ns : 0U));
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
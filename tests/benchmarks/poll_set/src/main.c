@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Poll set benchmark. The main thread waits on N semaphores while a lower
+ * priority thread gives them one at a time, round robin. Each iteration is
+ * one wake-up of the waiter, measured with k_poll() over all N events and
+ * with a persistent poll set holding the same events.
+ */
+
+#include <zephyr.h>
+#include <timing/timing.h>
+
+#define MAX_EVENTS 64
+#define N_ITERATIONS 1000
+#define STACK_SIZE 1024
+
+#define FORMAT "%-60s:%8u cycles , %8u ns\n"
+
+static struct k_sem sems[MAX_EVENTS];
+static struct k_poll_event events[MAX_EVENTS];
+static struct k_poll_set set;
+
+static K_THREAD_STACK_DEFINE(giver_stack, STACK_SIZE);
+static struct k_thread giver_thread;
+
+static void giver(void *p1, void *p2, void *p3)
+{
+	int num_events = POINTER_TO_INT(p1);
+
+	for (int i = 0; i < N_ITERATIONS; i++) {
+		k_sem_give(&sems[i % num_events]);
+	}
+}
+
+static void start_giver(int num_events)
+{
+	for (int i = 0; i < num_events; i++) {
+		k_sem_init(&sems[i], 0, 1);
+		k_poll_event_init(&events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &sems[i]);
+	}
+
+	k_thread_create(&giver_thread, giver_stack, STACK_SIZE, giver,
+			INT_TO_POINTER(num_events), NULL, NULL,
+			K_LOWEST_APPLICATION_THREAD_PRIO, 0, K_NO_WAIT);
+}
+
+static void report(const char *api, int num_events, uint64_t cycles)
+{
+	char name[64];
+
+	snprintk(name, sizeof(name), "%s wake-up, %d events", api, num_events);
+	printk(FORMAT, name, (uint32_t)(cycles / N_ITERATIONS),
+	       (uint32_t)timing_cycles_to_ns_avg(cycles, N_ITERATIONS));
+}
+
+static void bench_k_poll(int num_events)
+{
+	timing_t start, end;
+
+	start_giver(num_events);
+
+	start = timing_counter_get();
+	for (int i = 0; i < N_ITERATIONS; i++) {
+		for (int j = 0; j < num_events; j++) {
+			events[j].state = K_POLL_STATE_NOT_READY;
+		}
+
+		(void)k_poll(events, num_events, K_FOREVER);
+
+		for (int j = 0; j < num_events; j++) {
+			if (events[j].state == K_POLL_STATE_SEM_AVAILABLE) {
+				(void)k_sem_take(&sems[j], K_NO_WAIT);
+			}
+		}
+	}
+	end = timing_counter_get();
+
+	k_thread_join(&giver_thread, K_FOREVER);
+	report("k_poll", num_events, timing_cycles_get(&start, &end));
+}
+
+static void bench_poll_set(int num_events)
+{
+	struct k_poll_event *ready[MAX_EVENTS];
+	timing_t start, end;
+	int num_ready;
+
+	start_giver(num_events);
+	k_poll_set_init(&set, events, num_events);
+
+	start = timing_counter_get();
+	for (int i = 0; i < N_ITERATIONS; i++) {
+		num_ready = k_poll_set_wait(&set, ready, MAX_EVENTS,
+					    K_FOREVER);
+
+		for (int j = 0; j < num_ready; j++) {
+			(void)k_sem_take(ready[j]->sem, K_NO_WAIT);
+		}
+	}
+	end = timing_counter_get();
+
+	k_thread_join(&giver_thread, K_FOREVER);
+	k_poll_set_cleanup(&set);
+	report("k_poll_set_wait", num_events, timing_cycles_get(&start, &end));
+}
+
+void main(void)
+{
+	timing_init();
+	timing_start();
+
+	for (int n = 4; n <= MAX_EVENTS; n <<= 1) {
+		bench_k_poll(n);
+		bench_poll_set(n);
+	}
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
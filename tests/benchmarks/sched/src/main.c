@@ -86,6 +86,88 @@ static void partner_fn(void *arg1, void *arg2, void *arg3)
 	}
 }
 
+#if defined(CONFIG_SMP) && (CONFIG_MP_NUM_CPUS > 1)
+/* Second part, on SMP: two threads on different CPUs take turns at a
+ * mutex, then at a semaphore used as a lock, with short critical
+ * sections. Compare with and without CONFIG_ADAPTIVE_SPIN.
+ */
+#define N_LOCKS 10000
+
+static K_THREAD_STACK_ARRAY_DEFINE(contender_stacks, 2, 1024);
+static struct k_thread contenders[2];
+static struct k_mutex contended_mutex;
+static struct k_sem contended_sem;
+
+static void mutex_contender(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (int i = 0; i < N_LOCKS; i++) {
+		k_mutex_lock(&contended_mutex, K_FOREVER);
+		k_busy_wait(1);
+		k_mutex_unlock(&contended_mutex);
+		k_busy_wait(1);
+	}
+}
+
+static void sem_contender(void *arg1, void *arg2, void *arg3)
+{
+	ARG_UNUSED(arg1);
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	for (int i = 0; i < N_LOCKS; i++) {
+		k_sem_take(&contended_sem, K_FOREVER);
+		k_busy_wait(1);
+		k_sem_give(&contended_sem);
+		k_busy_wait(1);
+	}
+}
+
+static uint32_t contend(k_thread_entry_t entry)
+{
+	uint32_t start = k_cycle_get_32();
+
+	for (int i = 0; i < 2; i++) {
+		k_thread_create(&contenders[i], contender_stacks[i],
+				K_THREAD_STACK_SIZEOF(contender_stacks[i]),
+				entry, NULL, NULL, NULL,
+				K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < 2; i++) {
+		k_thread_join(&contenders[i], K_FOREVER);
+	}
+
+	return (k_cycle_get_32() - start) / (2 * N_LOCKS);
+}
+
+static void contention_bench(void)
+{
+	uint32_t mutex_avg, sem_avg;
+
+	k_mutex_init(&contended_mutex);
+	k_sem_init(&contended_sem, 1, 1);
+
+	mutex_avg = contend(mutex_contender);
+	sem_avg = contend(sem_contender);
+
+	printk("contended mutex %4u sem %4u (cycles per iteration)\n",
+	       mutex_avg, sem_avg);
+
+#ifdef CONFIG_ADAPTIVE_SPIN
+	struct k_adaptive_spin_stats stats;
+
+	k_adaptive_spin_stats_get(&stats);
+	printk("spin mutex hits %u misses %u sem hits %u misses %u\n",
+	       stats.mutex_hits, stats.mutex_misses,
+	       stats.sem_hits, stats.sem_misses);
+#endif
+}
+#endif
+
 void main(void)
 {
 	z_waitq_init(&waitq);
@@ -148,5 +230,9 @@ void main(void)
 		       stamps[4] - stamps[3],
 		       whole, avg);
 	}
+
+#if defined(CONFIG_SMP) && (CONFIG_MP_NUM_CPUS > 1)
+	contention_bench();
+#endif
 	printk("fin\n");
 }
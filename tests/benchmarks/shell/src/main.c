@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Shell command rate benchmark, over the dummy backend. NUM_CMDS root
+ * commands are registered next to the ones of the shell itself and
+ * executed in turn with shell_execute_cmd(), as a script driving the
+ * device would do: without output, which measures the command lookup,
+ * and printing a few lines, which also measures the output path. Build
+ * with CONFIG_SHELL_OUTPUT_BATCH to batch the output of each command.
+ */
+
+#include <zephyr.h>
+#include <timing/timing.h>
+#include <shell/shell.h>
+#include <shell/shell_dummy.h>
+
+#define NUM_CMDS 64
+#define N_EXECUTIONS 1000
+#define OUTPUT_LINES 4
+
+#define FORMAT "%-60s:%8u cycles , %8u ns\n"
+#define OPS_FORMAT "%-60s:%8u commands/s\n"
+
+static int cmd_quiet(const struct shell *shell, size_t argc, char **argv)
+{
+	return 0;
+}
+
+static int cmd_print(const struct shell *shell, size_t argc, char **argv)
+{
+	for (int i = 0; i < OUTPUT_LINES; i++) {
+		shell_print(shell, "%s: line %d, value 0x%08x", argv[0], i,
+			    i * 0x01010101);
+	}
+
+	return 0;
+}
+
+#define BENCH_CMD_DEFINE(_subcmd, _syntax)				\
+	SHELL_STATIC_SUBCMD_SET_CREATE(_subcmd,				\
+		SHELL_CMD(print, NULL, "Print lines", cmd_print),	\
+		SHELL_SUBCMD_SET_END					\
+	);								\
+	SHELL_CMD_REGISTER(_syntax, &_subcmd, "Benchmark command", cmd_quiet);
+
+#define BENCH_CMD_REGISTER(i, _) BENCH_CMD_DEFINE(sub_bench_##i, bench_##i)
+
+UTIL_LISTIFY(NUM_CMDS, BENCH_CMD_REGISTER, _)
+
+static char cmds[NUM_CMDS][24];
+
+static void report(const char *name, uint32_t ops, uint64_t cycles)
+{
+	uint64_t ns = timing_cycles_to_ns(cycles);
+
+	printk(FORMAT, name, (uint32_t)(cycles / ops),
+	       (uint32_t)timing_cycles_to_ns_avg(cycles, ops));
+	printk(OPS_FORMAT, name,
+	       (uint32_t)((ns != 0U) ?
+			  ((uint64_t)ops * NSEC_PER_SEC) / ns : 0U));
+}
+
+static int bench(const struct shell *shell, const char *name,
+		 const char *subcmd)
+{
+	timing_t start, end;
+	int err;
+
+	for (int i = 0; i < NUM_CMDS; i++) {
+		snprintk(cmds[i], sizeof(cmds[i]), "bench_%d%s", i, subcmd);
+	}
+
+	start = timing_counter_get();
+	for (uint32_t i = 0; i < N_EXECUTIONS; i++) {
+		const char *cmd = cmds[(i * 7U) % NUM_CMDS];
+
+		err = shell_execute_cmd(shell, cmd);
+		shell_backend_dummy_clear_output(shell);
+		if (err) {
+			printk("%s failed (err %d)\n", cmd, err);
+			return err;
+		}
+	}
+	end = timing_counter_get();
+
+	report(name, N_EXECUTIONS, timing_cycles_get(&start, &end));
+
+	return 0;
+}
+
+void main(void)
+{
+	const struct shell *shell = shell_backend_dummy_get_ptr();
+
+	/* Let the shell thread start */
+	k_sleep(K_MSEC(100));
+
+	timing_init();
+	timing_start();
+
+	if (bench(shell, "root command, no output", "") ||
+	    bench(shell, "subcommand, " STRINGIFY(OUTPUT_LINES) " lines output",
+		  " print")) {
+		timing_stop();
+		return;
+	}
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
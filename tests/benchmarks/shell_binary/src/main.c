@@ -0,0 +1,293 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Shell bulk data throughput benchmark. A shell instance runs over a
+ * transport fed from memory, as a UART backend with a large RX ring buffer
+ * would be, and BLOB_LEN bytes are written to the device twice: as hex
+ * encoded text commands, which go through the line editing, the echo and
+ * the command parsing, and as binary mode frames of
+ * CONFIG_SHELL_BINARY_FRAME_SIZE bytes. The rate is given in payload bytes
+ * per second.
+ */
+
+#include <zephyr.h>
+#include <string.h>
+#include <timing/timing.h>
+#include <sys/byteorder.h>
+#include <shell/shell.h>
+
+#define BLOB_LEN 16384
+#define LINE_DATA_LEN 32
+#define FRAME_LEN CONFIG_SHELL_BINARY_FRAME_SIZE
+
+/* "blob " followed by the hex data and a new line */
+#define LINE_LEN (5 + 2 * LINE_DATA_LEN + 1)
+#define TEXT_LEN ((BLOB_LEN / LINE_DATA_LEN) * LINE_LEN)
+#define BINARY_LEN (BLOB_LEN + (BLOB_LEN / FRAME_LEN + 1) * 3)
+
+#define FORMAT "%-60s:%8u cycles , %8u ns\n"
+#define RATE_FORMAT "%-60s:%8u bytes/s\n"
+
+BUILD_ASSERT((BLOB_LEN % FRAME_LEN) == 0);
+
+struct bench_transport {
+	shell_transport_handler_t handler;
+	void *context;
+	const uint8_t *rx;
+	size_t rx_len;
+	size_t rx_off;
+};
+
+static struct bench_transport bench_ctx;
+
+static K_SEM_DEFINE(ack_sem, 0, 1);
+static K_SEM_DEFINE(done_sem, 0, 1);
+
+static uint8_t blob[BLOB_LEN];
+static uint8_t text_input[TEXT_LEN];
+static uint8_t binary_input[BINARY_LEN];
+
+static uint32_t received;
+static uint32_t checksum;
+
+static int init(const struct shell_transport *transport,
+		const void *config,
+		shell_transport_handler_t evt_handler,
+		void *context)
+{
+	struct bench_transport *ctx = transport->ctx;
+
+	ctx->handler = evt_handler;
+	ctx->context = context;
+
+	return 0;
+}
+
+static int uninit(const struct shell_transport *transport)
+{
+	return 0;
+}
+
+static int enable(const struct shell_transport *transport, bool blocking)
+{
+	return 0;
+}
+
+static int write(const struct shell_transport *transport,
+		 const void *data, size_t length, size_t *cnt)
+{
+	/* Text output is ASCII, only frames hold the start byte */
+	if (memchr(data, SHELL_BINARY_FRAME_START, length)) {
+		k_sem_give(&ack_sem);
+	}
+
+	*cnt = length;
+
+	return 0;
+}
+
+static int read(const struct shell_transport *transport,
+		void *data, size_t length, size_t *cnt)
+{
+	struct bench_transport *ctx = transport->ctx;
+
+	*cnt = MIN(length, ctx->rx_len - ctx->rx_off);
+	memcpy(data, &ctx->rx[ctx->rx_off], *cnt);
+	ctx->rx_off += *cnt;
+
+	return 0;
+}
+
+static const struct shell_transport_api bench_transport_api = {
+	.init = init,
+	.uninit = uninit,
+	.enable = enable,
+	.write = write,
+	.read = read
+};
+
+static struct shell_transport bench_transport = {
+	.api = &bench_transport_api,
+	.ctx = &bench_ctx,
+};
+
+SHELL_DEFINE(bench_shell, "bench:~$ ", &bench_transport, 1, 0,
+	     SHELL_FLAG_OLF_CRLF);
+
+static void consume(const uint8_t *data, size_t len)
+{
+	for (size_t i = 0; i < len; i++) {
+		checksum += data[i];
+	}
+
+	received += len;
+}
+
+static int cmd_blob(const struct shell *shell, size_t argc, char **argv)
+{
+	uint8_t data[LINE_DATA_LEN];
+	size_t len;
+
+	len = hex2bin(argv[1], strlen(argv[1]), data, sizeof(data));
+	if (len == 0) {
+		return -EINVAL;
+	}
+
+	consume(data, len);
+	if (received == BLOB_LEN) {
+		k_sem_give(&done_sem);
+	}
+
+	return 0;
+}
+
+SHELL_CMD_ARG_REGISTER(blob, NULL, "Write hex data", cmd_blob, 2, 0);
+
+static int frame_handler(const struct shell *shell, const uint8_t *data,
+			 size_t len, void *user_data)
+{
+	if (len == 0) {
+		k_sem_give(&done_sem);
+		return 0;
+	}
+
+	consume(data, len);
+
+	return 0;
+}
+
+static int cmd_blob_binary(const struct shell *shell, size_t argc,
+			   char **argv)
+{
+	return shell_binary_mode_enter(shell, frame_handler, NULL);
+}
+
+SHELL_CMD_REGISTER(blob_binary, NULL, "Write binary frames",
+		   cmd_blob_binary);
+
+static void feed(const uint8_t *data, size_t len)
+{
+	bench_ctx.rx = data;
+	bench_ctx.rx_len = len;
+	bench_ctx.rx_off = 0;
+	bench_ctx.handler(SHELL_TRANSPORT_EVT_RX_RDY, bench_ctx.context);
+}
+
+static void prepare_input(void)
+{
+	uint8_t *p;
+
+	for (size_t i = 0; i < BLOB_LEN; i++) {
+		blob[i] = (uint8_t)(i * 7U);
+	}
+
+	p = text_input;
+	for (size_t i = 0; i < BLOB_LEN; i += LINE_DATA_LEN) {
+		memcpy(p, "blob ", 5);
+		p += 5;
+		p += bin2hex(&blob[i], LINE_DATA_LEN, (char *)p,
+			     2 * LINE_DATA_LEN + 1);
+		*p++ = '\n';
+	}
+
+	p = binary_input;
+	for (size_t i = 0; i < BLOB_LEN; i += FRAME_LEN) {
+		*p++ = SHELL_BINARY_FRAME_START;
+		sys_put_le16(FRAME_LEN, p);
+		p += 2;
+		memcpy(p, &blob[i], FRAME_LEN);
+		p += FRAME_LEN;
+	}
+
+	/* Empty frame, back to text mode */
+	*p++ = SHELL_BINARY_FRAME_START;
+	sys_put_le16(0, p);
+}
+
+static uint32_t blob_checksum(void)
+{
+	uint32_t sum = 0U;
+
+	for (size_t i = 0; i < BLOB_LEN; i++) {
+		sum += blob[i];
+	}
+
+	return sum;
+}
+
+static int bench(const char *name, const uint8_t *input, size_t len)
+{
+	timing_t start, end;
+	uint64_t cycles, ns;
+
+	received = 0U;
+	checksum = 0U;
+
+	start = timing_counter_get();
+	feed(input, len);
+	if (k_sem_take(&done_sem, K_SECONDS(10))) {
+		printk("%s: %u of %u bytes received\n", name, received,
+		       BLOB_LEN);
+		return -ETIMEDOUT;
+	}
+	end = timing_counter_get();
+
+	if ((received != BLOB_LEN) || (checksum != blob_checksum())) {
+		printk("%s: corrupted data\n", name);
+		return -EIO;
+	}
+
+	cycles = timing_cycles_get(&start, &end);
+	ns = timing_cycles_to_ns(cycles);
+
+	printk(FORMAT, name, (uint32_t)(cycles / (BLOB_LEN / 1024)),
+	       (uint32_t)timing_cycles_to_ns_avg(cycles, BLOB_LEN / 1024));
+	printk(RATE_FORMAT, name,
+	       (uint32_t)((ns != 0U) ?
+			  ((uint64_t)BLOB_LEN * NSEC_PER_SEC) / ns : 0U));
+
+	return 0;
+}
+
+static int enter_binary_mode(void)
+{
+	static const char cmd[] = "blob_binary\n";
+
+	feed((const uint8_t *)cmd, strlen(cmd));
+	if (k_sem_take(&ack_sem, K_SECONDS(1))) {
+		printk("Binary mode not acknowledged\n");
+		return -ETIMEDOUT;
+	}
+
+	return 0;
+}
+
+void main(void)
+{
+	prepare_input();
+
+	shell_init(&bench_shell, NULL, false, false, 0);
+
+	/* Let the shell thread start */
+	k_sleep(K_MSEC(100));
+
+	timing_init();
+	timing_start();
+
+	if (bench("text mode, hex commands, per KiB", text_input,
+		  sizeof(text_input)) ||
+	    enter_binary_mode() ||
+	    bench("binary mode, " STRINGIFY(FRAME_LEN) " bytes frames, per KiB",
+		  binary_input, sizeof(binary_input))) {
+		timing_stop();
+		return;
+	}
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Tracing overhead benchmark. A CTF trace point is hit in batches small
+ * enough for the tracing buffer, sleeping between batches so the tracing
+ * thread can drain it, and the cost of the trace point is averaged. On SMP
+ * the measurement is repeated with one thread per CPU tracing at the same
+ * time, which shows the contention of a buffer shared by all CPUs.
+ */
+
+#include <zephyr.h>
+#include <timing/timing.h>
+#include <tracing/tracing.h>
+
+#define N_BATCHES 32
+#define N_EVENTS 32
+#define STACK_SIZE 1024
+#define PRIO K_PRIO_PREEMPT(1)
+
+#define FORMAT "%-60s:%8u cycles , %8u ns\n"
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, CONFIG_MP_NUM_CPUS, STACK_SIZE);
+static struct k_thread threads[CONFIG_MP_NUM_CPUS];
+static uint64_t thread_cycles[CONFIG_MP_NUM_CPUS];
+
+static struct k_sem sem;
+
+static void trace_loop(void *p1, void *p2, void *p3)
+{
+	uint64_t *cycles = p1;
+	timing_t start, end;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	*cycles = 0U;
+
+	for (int b = 0; b < N_BATCHES; b++) {
+		start = timing_counter_get();
+		for (int i = 0; i < N_EVENTS; i++) {
+			sys_trace_k_sem_give_enter(&sem);
+		}
+		end = timing_counter_get();
+		*cycles += timing_cycles_get(&start, &end);
+
+		/* Let the tracing thread drain the buffer */
+		k_msleep(2 * CONFIG_TRACING_THREAD_WAIT_THRESHOLD);
+	}
+}
+
+static void report(const char *name, uint64_t cycles, uint32_t n)
+{
+	printk(FORMAT, name, (uint32_t)(cycles / n),
+	       (uint32_t)timing_cycles_to_ns_avg(cycles, n));
+}
+
+static void bench_threads(int num_threads)
+{
+	uint64_t cycles = 0U;
+	char name[64];
+
+	for (int t = 0; t < num_threads; t++) {
+		k_thread_create(&threads[t], stacks[t], STACK_SIZE,
+				trace_loop, &thread_cycles[t], NULL, NULL,
+				PRIO, 0, K_FOREVER);
+	}
+
+	for (int t = 0; t < num_threads; t++) {
+		k_thread_start(&threads[t]);
+	}
+
+	for (int t = 0; t < num_threads; t++) {
+		k_thread_join(&threads[t], K_FOREVER);
+		cycles += thread_cycles[t];
+	}
+
+	snprintk(name, sizeof(name), "Trace point (%s buffer), %d thread(s)",
+		 IS_ENABLED(CONFIG_TRACING_BUFFER_PER_CPU) ? "per-CPU" :
+							     "shared",
+		 num_threads);
+	report(name, cycles, num_threads * N_BATCHES * N_EVENTS);
+}
+
+void main(void)
+{
+	k_sem_init(&sem, 0, 1);
+
+	timing_init();
+	timing_start();
+
+	bench_threads(1);
+	if (CONFIG_MP_NUM_CPUS > 1) {
+		bench_threads(CONFIG_MP_NUM_CPUS);
+	}
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
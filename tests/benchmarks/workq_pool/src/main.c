@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Work queue pool benchmark. A batch of independent work items is submitted
+ * to a work queue served by 1, 2 and 4 threads and the queue is drained.
+ * Handlers either compute (busy wait), which only scales with the number
+ * of CPUs, or block (sleep), which scales with the number of threads.
+ */
+
+#include <zephyr.h>
+#include <timing/timing.h>
+
+#define MAX_THREADS 4
+#define N_ITEMS 64
+#define N_ROUNDS 4
+#define STACK_SIZE 1024
+#define PRIO K_PRIO_PREEMPT(1)
+
+#define COMPUTE_US 100
+#define BLOCK_MS 1
+
+#define FORMAT "%-60s:%8u cycles , %8u ns\n"
+
+/* One queue per pool size, as a started queue cannot be stopped. */
+#define N_QUEUES 3
+static const size_t pool_sizes[N_QUEUES] = { 1, 2, MAX_THREADS };
+
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, 1 + 2 + MAX_THREADS, STACK_SIZE);
+static struct k_thread threads[MAX_THREADS];
+static struct k_work_q queues[N_QUEUES];
+
+static struct k_work items[N_ITEMS];
+
+static void compute_handler(struct k_work *work)
+{
+	k_busy_wait(COMPUTE_US);
+}
+
+static void block_handler(struct k_work *work)
+{
+	k_msleep(BLOCK_MS);
+}
+
+static void start_queues(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "wq.bench",
+		.pin_threads = true,
+	};
+	size_t stack = 0;
+
+	for (int q = 0; q < N_QUEUES; q++) {
+		size_t n = pool_sizes[q];
+
+		/* Each queue uses n stacks and n - 1 additional threads. */
+		k_work_queue_pool_start(&queues[q], stacks[stack], STACK_SIZE,
+					n > 1 ? &threads[stack - q] : NULL, n,
+					PRIO, &cfg);
+		stack += n;
+	}
+}
+
+static void bench(int q, k_work_handler_t handler, const char *kind)
+{
+	size_t num_threads = pool_sizes[q];
+	timing_t start, end;
+	uint64_t cycles;
+	uint64_t ns;
+	char name[64];
+
+	for (int i = 0; i < N_ITEMS; i++) {
+		k_work_init(&items[i], handler);
+	}
+
+	start = timing_counter_get();
+
+	for (int r = 0; r < N_ROUNDS; r++) {
+		for (int i = 0; i < N_ITEMS; i++) {
+			(void)k_work_submit_to_queue(&queues[q], &items[i]);
+		}
+		(void)k_work_queue_drain(&queues[q], false);
+	}
+
+	end = timing_counter_get();
+	cycles = timing_cycles_get(&start, &end);
+	ns = timing_cycles_to_ns(cycles);
+
+	snprintk(name, sizeof(name), "%s work item, %u thread(s)", kind,
+		 (unsigned int)num_threads);
+	printk(FORMAT, name, (uint32_t)(cycles / (N_ROUNDS * N_ITEMS)),
+	       (uint32_t)timing_cycles_to_ns_avg(cycles, N_ROUNDS * N_ITEMS));
+	printk("%-60s:%8u items/s\n", name,
+	       (uint32_t)((uint64_t)N_ROUNDS * N_ITEMS * NSEC_PER_SEC / ns));
+}
+
+void main(void)
+{
+	timing_init();
+	timing_start();
+
+	start_queues();
+
+	for (int q = 0; q < N_QUEUES; q++) {
+		bench(q, compute_handler, "Compute");
+	}
+
+	for (int q = 0; q < N_QUEUES; q++) {
+		bench(q, block_handler, "Blocking");
+	}
+
+	timing_stop();
+
+	printk("PROJECT EXECUTION SUCCESSFUL\n");
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr.h>
+#include <ztest.h>
+#include <string.h>
+#include <drivers/dma.h>
+#include <drivers/dma/dma_memcpy.h>
+
+#define BUF_SIZE 4099
+#define N_OPS 4
+
+static uint8_t src_buf[BUF_SIZE];
+static uint8_t dst_buf[N_OPS][BUF_SIZE];
+
+static struct dma_memcpy_op ops[N_OPS];
+static K_SEM_DEFINE(done_sem, 0, N_OPS);
+static int done_status[N_OPS];
+static int done_order[N_OPS];
+static int done_count;
+
+static void done(struct dma_memcpy_op *op, int status, void *user_data)
+{
+	int idx = POINTER_TO_INT(user_data);
+
+	done_status[idx] = status;
+	done_order[done_count++] = idx;
+	k_sem_give(&done_sem);
+}
+
+static void reset(void)
+{
+	for (int i = 0; i < BUF_SIZE; i++) {
+		src_buf[i] = (uint8_t)(i * 7 + 3);
+	}
+
+	memset(dst_buf, 0, sizeof(dst_buf));
+	memset(done_status, 0xff, sizeof(done_status));
+	done_count = 0;
+	k_sem_reset(&done_sem);
+}
+
+static void test_memcpy_large(void)
+{
+	reset();
+
+	zassert_ok(dma_memcpy_async(&ops[0], dst_buf[0], src_buf, BUF_SIZE,
+				    done, INT_TO_POINTER(0)), NULL);
+	zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)), "no completion");
+	zassert_ok(done_status[0], "copy failed");
+	zassert_mem_equal(dst_buf[0], src_buf, BUF_SIZE, "data mismatch");
+}
+
+static void test_memcpy_unaligned(void)
+{
+	reset();
+
+	zassert_ok(dma_memcpy_async(&ops[0], &dst_buf[0][1], &src_buf[3],
+				    BUF_SIZE - 3, done, INT_TO_POINTER(0)),
+		   NULL);
+	zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)), "no completion");
+	zassert_ok(done_status[0], "copy failed");
+	zassert_equal(dst_buf[0][0], 0, "copied before destination");
+	zassert_mem_equal(&dst_buf[0][1], &src_buf[3], BUF_SIZE - 3,
+			  "data mismatch");
+}
+
+static void test_memset(void)
+{
+	uint8_t expected[BUF_SIZE];
+
+	reset();
+	memset(expected, 0xa5, sizeof(expected));
+
+	zassert_ok(dma_memset_async(&ops[0], dst_buf[0], 0xa5, BUF_SIZE,
+				    done, INT_TO_POINTER(0)), NULL);
+	zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)), "no completion");
+	zassert_ok(done_status[0], "fill failed");
+	zassert_mem_equal(dst_buf[0], expected, BUF_SIZE, "data mismatch");
+}
+
+/* Copies below the threshold are done before returning */
+static void test_memcpy_small(void)
+{
+	size_t len = CONFIG_DMA_MEMCPY_THRESHOLD - 1;
+
+	reset();
+
+	zassert_ok(dma_memcpy_async(&ops[0], dst_buf[0], src_buf, len, done,
+				    INT_TO_POINTER(0)), NULL);
+	zassert_equal(done_count, 1, "small copy not done synchronously");
+	zassert_ok(done_status[0], "copy failed");
+	zassert_mem_equal(dst_buf[0], src_buf, len, "data mismatch");
+}
+
+/* Queued operations complete in order */
+static void test_memcpy_queue(void)
+{
+	reset();
+
+	for (int i = 0; i < N_OPS; i++) {
+		zassert_ok(dma_memcpy_async(&ops[i], dst_buf[i], src_buf,
+					    BUF_SIZE - i, done,
+					    INT_TO_POINTER(i)), NULL);
+	}
+
+	for (int i = 0; i < N_OPS; i++) {
+		zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)),
+			   "no completion");
+	}
+
+	for (int i = 0; i < N_OPS; i++) {
+		zassert_equal(done_order[i], i, "completed out of order");
+		zassert_ok(done_status[i], "copy failed");
+		zassert_mem_equal(dst_buf[i], src_buf, BUF_SIZE - i,
+				  "data mismatch");
+	}
+}
+
+/* A small copy submitted behind a pending one is not done first */
+static void test_memcpy_small_queued(void)
+{
+	size_t len = CONFIG_DMA_MEMCPY_THRESHOLD - 1;
+
+	reset();
+
+	zassert_ok(dma_memcpy_async(&ops[0], dst_buf[0], src_buf, BUF_SIZE,
+				    done, INT_TO_POINTER(0)), NULL);
+	zassert_ok(dma_memcpy_async(&ops[1], dst_buf[1], src_buf, len, done,
+				    INT_TO_POINTER(1)), NULL);
+
+	for (int i = 0; i < 2; i++) {
+		zassert_ok(k_sem_take(&done_sem, K_SECONDS(1)),
+			   "no completion");
+	}
+
+	zassert_equal(done_order[0], 0, "completed out of order");
+	zassert_equal(done_order[1], 1, "completed out of order");
+	zassert_ok(done_status[1], "copy failed");
+	zassert_mem_equal(dst_buf[1], src_buf, len, "data mismatch");
+}
+
+#define N_BLOCKS 3
+#define BLOCK_SIZE 64
+
+static uint32_t chain_callbacks;
+static K_SEM_DEFINE(chain_sem, 0, 1);
+
+static void chain_done(const struct device *dev, void *user_data,
+		       uint32_t channel, int status)
+{
+	chain_callbacks++;
+	if (chain_callbacks == N_BLOCKS) {
+		k_sem_give(&chain_sem);
+	}
+}
+
+/* The emulated controller follows the whole block chain, with a
+ * callback per block when asked to.
+ */
+static void test_emul_block_chain(void)
+{
+	const struct device *dev = DEVICE_DT_GET(DT_CHOSEN(zephyr_dma_memcpy));
+	struct dma_block_config blocks[N_BLOCKS] = { 0 };
+	struct dma_config cfg = { 0 };
+	int channel;
+
+	reset();
+	chain_callbacks = 0U;
+
+	/* Blocks copied in reverse order of the buffer */
+	for (int i = 0; i < N_BLOCKS; i++) {
+		blocks[i].source_address = (uintptr_t)&src_buf[i * BLOCK_SIZE];
+		blocks[i].dest_address =
+			(uintptr_t)&dst_buf[0][(N_BLOCKS - 1 - i) * BLOCK_SIZE];
+		blocks[i].block_size = BLOCK_SIZE;
+		blocks[i].next_block = (i + 1 < N_BLOCKS) ? &blocks[i + 1]
+							  : NULL;
+	}
+
+	cfg.channel_direction = MEMORY_TO_MEMORY;
+	cfg.complete_callback_en = 1U;
+	cfg.source_data_size = 4U;
+	cfg.dest_data_size = 4U;
+	cfg.block_count = N_BLOCKS;
+	cfg.head_block = &blocks[0];
+	cfg.dma_callback = chain_done;
+
+	channel = dma_request_channel(dev, NULL);
+	zassert_true(channel >= 0, "no channel left");
+
+	zassert_ok(dma_config(dev, channel, &cfg), NULL);
+	zassert_ok(dma_start(dev, channel), NULL);
+	zassert_ok(k_sem_take(&chain_sem, K_SECONDS(1)), "no completion");
+
+	for (int i = 0; i < N_BLOCKS; i++) {
+		zassert_mem_equal(&dst_buf[0][(N_BLOCKS - 1 - i) * BLOCK_SIZE],
+				  &src_buf[i * BLOCK_SIZE], BLOCK_SIZE,
+				  "block %d mismatch", i);
+	}
+
+	dma_release_channel(dev, channel);
+}
+
+void test_main(void)
+{
+	ztest_test_suite(dma_memcpy_test,
+			 ztest_unit_test(test_memcpy_large),
+			 ztest_unit_test(test_memcpy_unaligned),
+			 ztest_unit_test(test_memset),
+			 ztest_unit_test(test_memcpy_small),
+			 ztest_unit_test(test_memcpy_queue),
+			 ztest_unit_test(test_memcpy_small_queued),
+			 ztest_unit_test(test_emul_block_chain));
+	ztest_run_test_suite(dma_memcpy_test);
+}
@@ -46,6 +46,67 @@ void test_sensor_accel_basic(void)
 	}
 }
 
+#ifdef CONFIG_SENSOR_STREAM
+#define STREAM_SAMPLES 32
+
+ZTEST_BMEM static union {
+	struct sensor_frame frame;
+	uint8_t buf[sizeof(struct sensor_frame) +
+		    STREAM_SAMPLES * 2 * 3 * sizeof(int16_t)];
+} stream;
+
+void test_sensor_accel_stream(void)
+{
+	struct sensor_frame *frame = &stream.frame;
+	const struct device *dev;
+	uint64_t last_ns;
+	int count;
+
+	dev = device_get_binding(accel_label);
+	zassert_not_null(dev, "failed: dev '%s' is null", accel_label);
+
+	zassert_ok(sensor_stream_start(dev), "fail to start streaming");
+
+	/* 10 samples at the default ODR of 100 Hz */
+	k_sleep(K_MSEC(105));
+
+	count = sensor_stream_read(dev, frame, sizeof(stream));
+	zassert_true(count >= 9 && count <= 11, "read %d samples", count);
+	zassert_equal(count, frame->num_samples, "wrong sample count");
+	zassert_equal(frame->period_ns, 10000000, "wrong period %u",
+		      frame->period_ns);
+
+	last_ns = frame->timestamp_ns + (count - 1) * frame->period_ns;
+	zassert_true(last_ns <= k_ticks_to_ns_floor64(k_uptime_ticks()),
+		     "timestamp in the future");
+
+	for (int s = 0; s < count; s++) {
+		for (int i = 0; i < ARRAY_SIZE(channel); i++) {
+			struct sensor_value val;
+
+			zassert_ok(sensor_frame_decode(dev, frame, s,
+						       channel[i], &val),
+				   "fail to decode sample %d", s);
+			zassert_equal(i, val.val1, "expected %d, got %d", i,
+				      val.val1);
+		}
+	}
+
+	/* The FIFO was drained */
+	count = sensor_stream_read(dev, frame, sizeof(stream));
+	zassert_true(count >= 0 && count <= 1, "read %d samples", count);
+
+	zassert_ok(sensor_stream_stop(dev), "fail to stop streaming");
+	zassert_equal(sensor_stream_read(dev, frame, sizeof(stream)), -EINVAL,
+		      "read while not streaming");
+}
+#else
+void test_sensor_accel_stream(void)
+{
+	ztest_test_skip();
+}
+#endif /* CONFIG_SENSOR_STREAM */
+
 /* Run all of our tests on an accelerometer device with the given label */
 static void run_tests_on_accel(const char *label)
 {
@@ -56,7 +117,8 @@ static void run_tests_on_accel(const char *label)
 	k_object_access_grant(accel, k_current_get());
 	accel_label = label;
 	ztest_test_suite(test_sensor_accel,
-			 ztest_user_unit_test(test_sensor_accel_basic));
+			 ztest_user_unit_test(test_sensor_accel_basic),
+			 ztest_user_unit_test(test_sensor_accel_stream));
 	ztest_run_test_suite(test_sensor_accel);
 }
 
@@ -11,6 +11,8 @@
 
 #ifdef CONFIG_BACKING_STORE_RAM_PAGES
 #define EXTRA_PAGES	(CONFIG_BACKING_STORE_RAM_PAGES - 1)
+#elif defined(CONFIG_BACKING_STORE_COMPRESSED_RAM)
+#define EXTRA_PAGES	(CONFIG_BACKING_STORE_COMPRESSED_RAM_SLOTS - 1)
 #else
 #error "Unsupported configuration"
 #endif
@@ -108,6 +110,11 @@ void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *scope)
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+	printk("    - Pages evicted in batches: %lu\n",
+	       stats->eviction.batched);
+
+	printk("* Read-ahead (%s):\n", scope);
+	printk("    - Pages read ahead: %lu\n", stats->read_ahead.pages);
 }
 
 void test_touch_anon_pages(void)
@@ -207,9 +214,18 @@ void test_k_mem_page_out(void)
 	faults = z_num_pagefaults_get() - faults;
 	irq_unlock(key);
 
-	zassert_equal(faults, HALF_PAGES,
-		      "unexpected num pagefaults expected %lu got %d",
-		      HALF_PAGES, faults);
+	if (CONFIG_DEMAND_PAGING_READ_AHEAD > 0) {
+		/* Sequential access: pages following a faulting one are
+		 * read ahead into the frames freed by k_mem_page_out()
+		 */
+		zassert_true(faults < (unsigned long)HALF_PAGES,
+			     "expected fewer than %d pagefaults got %lu",
+			     HALF_PAGES, faults);
+	} else {
+		zassert_equal(faults, HALF_PAGES,
+			      "unexpected num pagefaults expected %lu got %d",
+			      HALF_PAGES, faults);
+	}
 
 	ret = k_mem_page_out(arena, arena_size);
 	zassert_equal(ret, -ENOMEM, "k_mem_page_out should have failed");
@@ -283,6 +299,40 @@ void test_k_mem_unpin(void)
 	test_k_mem_page_out();
 }
 
+/* Show that the compressed backing store stored zero pages without
+ * compressing them and compressed the test pattern.
+ */
+void test_compressed_stats(void)
+{
+#ifdef CONFIG_BACKING_STORE_COMPRESSED_RAM
+	struct k_mem_paging_backing_store_compressed_stats stats;
+
+	k_mem_paging_backing_store_compressed_stats_get(&stats);
+
+	printk("* Compressed backing store:\n");
+	printk("    - Pages stored: %lu (%lu bytes)\n", stats.pages_stored,
+	       stats.bytes_used);
+	printk("    - Pages out: %lu (zero %lu, lz4 %lu, raw %lu)\n",
+	       stats.page_outs, stats.zero_pages, stats.lz4_pages,
+	       stats.raw_pages);
+	printk("    - Bytes in: %u, out: %u\n", (uint32_t)stats.bytes_in,
+	       (uint32_t)stats.bytes_out);
+	printk("    - Pages in: %lu, average %u cycles, max %u cycles\n",
+	       stats.page_ins,
+	       (uint32_t)(stats.page_ins ?
+			  stats.page_in_cycles / stats.page_ins : 0),
+	       stats.page_in_cycles_max);
+
+	zassert_not_equal(stats.zero_pages, 0UL, "no zero pages stored");
+	zassert_not_equal(stats.lz4_pages, 0UL, "no compressed pages stored");
+	zassert_not_equal(stats.page_ins, 0UL, "no pages paged in");
+	zassert_true(stats.bytes_out < stats.bytes_in,
+		     "test pattern did not compress");
+#else
+	ztest_test_skip();
+#endif
+}
+
 /* Show that even if we map enough anonymous memory to fill the backing
  * store, we can still handle pagefaults.
  * This eats up memory so should be last in the suite.
@@ -292,8 +342,7 @@ void test_backing_store_capacity(void)
 	char *mem, *ret;
 	int key;
 	unsigned long faults;
-	size_t size = (((CONFIG_BACKING_STORE_RAM_PAGES - 1) - HALF_PAGES) *
-		       CONFIG_MMU_PAGE_SIZE);
+	size_t size = ((EXTRA_PAGES - HALF_PAGES) * CONFIG_MMU_PAGE_SIZE);
 
 	/* Consume the rest of memory */
 	mem = k_mem_map(size, K_MEM_PERM_RW);
@@ -410,6 +459,7 @@ void test_main(void)
 			ztest_unit_test(test_k_mem_page_in),
 			ztest_unit_test(test_k_mem_pin),
 			ztest_unit_test(test_k_mem_unpin),
+			ztest_unit_test(test_compressed_stats),
 			ztest_unit_test(test_backing_store_capacity),
 			ztest_user_unit_test(test_user_get_stats),
 			ztest_user_unit_test(test_user_get_hist));
@@ -21,6 +21,9 @@ static struct k_sem *dyn_sem[SEM_ARRAY_SIZE];
 
 static struct k_mutex *test_dyn_mutex;
 
+#define DYN_OBJ_COUNT	32
+static void *dyn_objs[DYN_OBJ_COUNT];
+
 K_SEM_DEFINE(sem1, 0, 1);
 static struct k_sem sem2;
 static char bad_sem[sizeof(struct k_sem)];
@@ -183,6 +186,56 @@ void test_no_ref_dyn_kobj_release_mem(void)
 	zassert_true(ret == -EBADF, "Dynamic kernel object not released");
 }
 
+/**
+ * @brief Test lookup of many dynamically allocated kernel objects
+ *
+ * @details Allocate more objects than the dynamic object hash table has
+ * buckets, check that each one is found, free half of them and check that
+ * only the remaining ones are still found, also after having been looked
+ * up before being freed.
+ *
+ * @ingroup kernel_memprotect_tests
+ *
+ * @see k_object_alloc(), k_object_free()
+ */
+void test_dyn_kobj_lookup_many(void)
+{
+	struct z_object *ko;
+
+	for (int i = 0; i < DYN_OBJ_COUNT; i++) {
+		dyn_objs[i] = k_object_alloc(K_OBJ_SEM);
+		zassert_not_null(dyn_objs[i], "couldn't allocate object %d", i);
+	}
+
+	for (int i = 0; i < DYN_OBJ_COUNT; i++) {
+		ko = z_object_find(dyn_objs[i]);
+		zassert_not_null(ko, "object %d not found", i);
+		zassert_equal(ko->name, dyn_objs[i], "wrong object %d", i);
+		zassert_equal(ko->type, K_OBJ_SEM, "wrong type %d", i);
+	}
+
+	for (int i = 0; i < DYN_OBJ_COUNT; i += 2) {
+		k_object_free(dyn_objs[i]);
+	}
+
+	for (int i = 0; i < DYN_OBJ_COUNT; i++) {
+		ko = z_object_find(dyn_objs[i]);
+		if ((i % 2) == 0) {
+			zassert_is_null(ko, "freed object %d found", i);
+		} else {
+			zassert_not_null(ko, "object %d not found", i);
+			zassert_equal(ko->name, dyn_objs[i], "wrong object %d",
+				      i);
+		}
+	}
+
+	for (int i = 1; i < DYN_OBJ_COUNT; i += 2) {
+		k_object_free(dyn_objs[i]);
+		zassert_is_null(z_object_find(dyn_objs[i]),
+				"freed object %d found", i);
+	}
+}
+
 void test_main(void)
 {
 	k_thread_system_pool_assign(k_current_get());
@@ -190,7 +243,8 @@ void test_main(void)
 	ztest_test_suite(object_validation,
 			 ztest_unit_test(test_generic_object),
 			 ztest_unit_test(test_kobj_assign_perms_on_alloc_obj),
-			 ztest_unit_test(test_no_ref_dyn_kobj_release_mem)
+			 ztest_unit_test(test_no_ref_dyn_kobj_release_mem),
+			 ztest_unit_test(test_dyn_kobj_lookup_many)
 			 );
 	ztest_run_test_suite(object_validation);
 }
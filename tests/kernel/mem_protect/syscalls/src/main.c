@@ -10,6 +10,7 @@
 #include <linker/linker-defs.h>
 #include "test_syscalls.h"
 #include <mmu.h>
+#include <sys/syscall_batch.h>
 
 #define BUF_SIZE	32
 #define SLEEP_MS_LONG	15000
@@ -316,6 +317,57 @@ void test_more_args(void)
 		      "syscall didn't match impl");
 }
 
+/**
+ * @brief Test batching system calls
+ *
+ * Run test system calls with various argument layouts in one batch and
+ * check that each returns the same as when invoked on its own.
+ *
+ * @ingroup kernel_memprotect_tests
+ *
+ * @see k_syscall_batch()
+ */
+void test_syscall_batch(void)
+{
+#ifdef CONFIG_SYSCALL_BATCH
+	char buf[BUF_SIZE];
+	int err = -1;
+	uintptr_t more[] = { 6, 7 };
+	struct k_syscall_op ops[] = {
+		K_SYSCALL_OP(K_SYSCALL_SYSCALL_CONTEXT),
+		K_SYSCALL_OP(K_SYSCALL_STRING_NLEN, (uintptr_t)user_string,
+			     BUF_SIZE, (uintptr_t)&err),
+		K_SYSCALL_OP(K_SYSCALL_TO_COPY, (uintptr_t)buf),
+		K_SYSCALL_OP(K_SYSCALL_SYSCALL_ARG64,
+			     K_SYSCALL_OP_ARG64(54321)),
+		K_SYSCALL_OP(K_SYSCALL_MORE_ARGS, 1, 2, 3, 4, 5,
+			     (uintptr_t)more),
+	};
+	int ret;
+
+	ret = k_syscall_batch(ops, ARRAY_SIZE(ops));
+	zassert_equal(ret, 0, "batch failed");
+
+	zassert_true((bool)ops[0].ret, "not reported in user syscall");
+	zassert_equal(ops[1].ret, strlen(user_string),
+		      "incorrect length returned");
+	zassert_equal(err, 0, "user string faulted");
+	zassert_equal(ops[2].ret, 0, "copy should have been a success");
+	zassert_equal(strcmp(buf, user_string), 0,
+		      "string should have matched");
+	zassert_equal((int)ops[3].ret, z_impl_syscall_arg64(54321),
+		      "syscall didn't match impl");
+	zassert_equal((uint32_t)ops[4].ret,
+		      z_impl_more_args(1, 2, 3, 4, 5, 6, 7),
+		      "syscall didn't match impl");
+
+	/* An empty batch does nothing */
+	zassert_equal(k_syscall_batch(NULL, 0), 0, "empty batch failed");
+#else
+	ztest_test_skip();
+#endif
+}
+
 #define NR_THREADS	(CONFIG_MP_NUM_CPUS * 4)
 #define STACK_SZ	(1024 + CONFIG_TEST_EXTRA_STACKSIZE)
 
@@ -441,6 +493,7 @@ void test_main(void)
 			 ztest_user_unit_test(test_user_string_alloc_copy),
 			 ztest_user_unit_test(test_arg64),
 			 ztest_user_unit_test(test_more_args),
+			 ztest_user_unit_test(test_syscall_batch),
 			 ztest_unit_test(test_syscall_torture),
 			 ztest_unit_test(test_syscall_context)
 			 );
@@ -23,6 +23,9 @@ extern void test_msgq_alloc(void);
 extern void test_msgq_pend_thread(void);
 extern void test_msgq_empty(void);
 extern void test_msgq_full(void);
+extern void test_msgq_batch_put_get(void);
+extern void test_msgq_batch_put_wake_all(void);
+extern void test_msgq_batch_get_wake_all(void);
 #ifdef CONFIG_USERSPACE
 extern void test_msgq_user_thread(void);
 extern void test_msgq_user_thread_overflow(void);
@@ -84,6 +87,9 @@ void test_main(void)
 			 ztest_1cpu_unit_test(test_msgq_pend_thread),
 			 ztest_1cpu_unit_test(test_msgq_empty),
 			 ztest_1cpu_unit_test(test_msgq_full),
-			 ztest_unit_test(test_msgq_alloc));
+			 ztest_unit_test(test_msgq_alloc),
+			 ztest_unit_test(test_msgq_batch_put_get),
+			 ztest_1cpu_unit_test(test_msgq_batch_put_wake_all),
+			 ztest_1cpu_unit_test(test_msgq_batch_get_wake_all));
 	ztest_run_test_suite(msgq_api);
 }
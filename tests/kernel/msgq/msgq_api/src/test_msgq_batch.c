@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#define BATCH_LEN 8
+#define NUM_WAITERS 2
+
+K_THREAD_STACK_ARRAY_DEFINE(batch_stack, NUM_WAITERS, STACK_SIZE);
+static struct k_thread batch_thread[NUM_WAITERS];
+static char __aligned(4) batch_buffer[MSG_SIZE * BATCH_LEN];
+static struct k_msgq batch_msgq;
+static uint32_t waiter_msg[NUM_WAITERS];
+
+static void batch_fill(uint32_t *msgs, uint32_t num, uint32_t first)
+{
+	for (uint32_t i = 0; i < num; i++) {
+		msgs[i] = first + i;
+	}
+}
+
+static void batch_check(const uint32_t *msgs, uint32_t num, uint32_t first)
+{
+	for (uint32_t i = 0; i < num; i++) {
+		zassert_equal(msgs[i], first + i, "message %u out of order", i);
+	}
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test sending and receiving batches of messages
+ *
+ * @details Batches are truncated to the space or data available, keep
+ * FIFO order across the end of the ring buffer and fail with -ENOMSG
+ * without waiting when nothing can be moved.
+ *
+ * @see k_msgq_put_many(), k_msgq_get_many()
+ */
+void test_msgq_batch_put_get(void)
+{
+	uint32_t msgs[BATCH_LEN + 2];
+
+	k_msgq_init(&batch_msgq, batch_buffer, MSG_SIZE, BATCH_LEN);
+
+	batch_fill(msgs, 5, 0);
+	zassert_equal(k_msgq_put_many(&batch_msgq, msgs, 5, K_NO_WAIT), 5,
+		      NULL);
+	batch_fill(msgs, 5, 5);
+	zassert_equal(k_msgq_put_many(&batch_msgq, msgs, 5, K_NO_WAIT), 3,
+		      NULL);
+	zassert_equal(k_msgq_put_many(&batch_msgq, msgs, 1, K_NO_WAIT),
+		      -ENOMSG, NULL);
+
+	zassert_equal(k_msgq_get_many(&batch_msgq, msgs, 6, K_NO_WAIT), 6,
+		      NULL);
+	batch_check(msgs, 6, 0);
+
+	/* wrap around the end of the ring buffer */
+	batch_fill(msgs, 6, 8);
+	zassert_equal(k_msgq_put_many(&batch_msgq, msgs, 6, K_NO_WAIT), 6,
+		      NULL);
+	zassert_equal(k_msgq_num_used_get(&batch_msgq), BATCH_LEN, NULL);
+
+	zassert_equal(k_msgq_get_many(&batch_msgq, msgs, BATCH_LEN + 2,
+				      K_NO_WAIT), BATCH_LEN, NULL);
+	batch_check(msgs, BATCH_LEN, 6);
+
+	zassert_equal(k_msgq_get_many(&batch_msgq, msgs, 1, K_NO_WAIT),
+		      -ENOMSG, NULL);
+	zassert_equal(k_msgq_get_many(&batch_msgq, msgs, 1, TIMEOUT),
+		      -EAGAIN, NULL);
+}
+
+static void batch_receiver(void *p1, void *p2, void *p3)
+{
+	uint32_t *msg = p1;
+
+	zassert_equal(k_msgq_get(&batch_msgq, msg, K_FOREVER), 0, NULL);
+}
+
+/**
+ * @brief Test that one batch put wakes every waiting receiver
+ *
+ * @see k_msgq_put_many()
+ */
+void test_msgq_batch_put_wake_all(void)
+{
+	uint32_t msgs[NUM_WAITERS + 1];
+
+	k_msgq_init(&batch_msgq, batch_buffer, MSG_SIZE, BATCH_LEN);
+
+	for (int i = 0; i < NUM_WAITERS; i++) {
+		waiter_msg[i] = 0U;
+		k_thread_create(&batch_thread[i], batch_stack[i], STACK_SIZE,
+				batch_receiver, &waiter_msg[i], NULL, NULL,
+				K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	}
+
+	/* let both receivers pend on the empty queue */
+	k_msleep(TIMEOUT_MS >> 1);
+
+	batch_fill(msgs, NUM_WAITERS + 1, 100);
+	zassert_equal(k_msgq_put_many(&batch_msgq, msgs, NUM_WAITERS + 1,
+				      K_NO_WAIT), NUM_WAITERS + 1, NULL);
+
+	for (int i = 0; i < NUM_WAITERS; i++) {
+		k_thread_join(&batch_thread[i], K_FOREVER);
+		zassert_equal(waiter_msg[i], 100 + i, NULL);
+	}
+
+	/* the message no receiver was waiting for stays queued */
+	zassert_equal(k_msgq_num_used_get(&batch_msgq), 1, NULL);
+}
+
+static void batch_sender(void *p1, void *p2, void *p3)
+{
+	zassert_equal(k_msgq_put(&batch_msgq, p1, K_FOREVER), 0, NULL);
+}
+
+/**
+ * @brief Test that one batch get refills from every waiting sender
+ *
+ * @see k_msgq_get_many()
+ */
+void test_msgq_batch_get_wake_all(void)
+{
+	uint32_t msgs[BATCH_LEN];
+
+	k_msgq_init(&batch_msgq, batch_buffer, MSG_SIZE, BATCH_LEN);
+
+	batch_fill(msgs, BATCH_LEN, 0);
+	zassert_equal(k_msgq_put_many(&batch_msgq, msgs, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN, NULL);
+
+	for (int i = 0; i < NUM_WAITERS; i++) {
+		waiter_msg[i] = BATCH_LEN + i;
+		k_thread_create(&batch_thread[i], batch_stack[i], STACK_SIZE,
+				batch_sender, &waiter_msg[i], NULL, NULL,
+				K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	}
+
+	/* let both senders pend on the full queue */
+	k_msleep(TIMEOUT_MS >> 1);
+
+	zassert_equal(k_msgq_get_many(&batch_msgq, msgs, 3, K_NO_WAIT), 3,
+		      NULL);
+	batch_check(msgs, 3, 0);
+
+	for (int i = 0; i < NUM_WAITERS; i++) {
+		k_thread_join(&batch_thread[i], K_FOREVER);
+	}
+
+	zassert_equal(k_msgq_num_used_get(&batch_msgq),
+		      BATCH_LEN - 3 + NUM_WAITERS, NULL);
+	zassert_equal(k_msgq_get_many(&batch_msgq, msgs, BATCH_LEN, K_NO_WAIT),
+		      BATCH_LEN - 3 + NUM_WAITERS, NULL);
+	batch_check(msgs, BATCH_LEN - 3 + NUM_WAITERS, 3);
+}
+
+/**
+ * @}
+ */
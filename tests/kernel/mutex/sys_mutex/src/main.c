@@ -366,8 +366,10 @@ void test_supervisor_access(void)
 {
 	int rv;
 
-#ifdef CONFIG_USERSPACE
-	/* coverage for get_k_mutex checks */
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FAST_PATH)
+	/* coverage for get_sys_mutex_data checks, the fast path would
+	 * dereference these pointers
+	 */
 	rv = sys_mutex_lock((struct sys_mutex *)NULL, K_NO_WAIT);
 	zassert_true(rv == -EINVAL, "accepted bad mutex pointer");
 	rv = sys_mutex_lock((struct sys_mutex *)k_current_get(), K_NO_WAIT);
@@ -376,7 +378,7 @@ void test_supervisor_access(void)
 	zassert_true(rv == -EINVAL, "accepted bad mutex pointer");
 	rv = sys_mutex_unlock((struct sys_mutex *)k_current_get());
 	zassert_true(rv == -EINVAL, "accepted object that was not a mutex");
-#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_USERSPACE && !CONFIG_SYS_MUTEX_FAST_PATH */
 
 	rv = sys_mutex_unlock(&not_my_mutex);
 	zassert_true(rv == -EPERM, "unlocked a mutex that wasn't owner");
@@ -386,7 +388,7 @@ void test_supervisor_access(void)
 
 void test_user_access(void)
 {
-#ifdef CONFIG_USERSPACE
+#if defined(CONFIG_USERSPACE) && !defined(CONFIG_SYS_MUTEX_FAST_PATH)
 	int rv;
 
 	rv = sys_mutex_lock(&no_access_mutex, K_NO_WAIT);
@@ -395,7 +397,7 @@ void test_user_access(void)
 	zassert_true(rv == -EACCES, "accessed mutex not in memory domain");
 #else
 	ztest_test_skip();
-#endif /* CONFIG_USERSPACE */
+#endif /* CONFIG_USERSPACE && !CONFIG_SYS_MUTEX_FAST_PATH */
 }
 
 K_THREAD_DEFINE(THREAD_05, STACKSIZE, thread_05, NULL, NULL, NULL,
@@ -49,6 +49,12 @@ extern void test_pipe_avail_r_eq_w_full(void);
 extern void test_pipe_avail_r_eq_w_empty(void);
 extern void test_pipe_avail_no_buffer(void);
 
+extern void test_pipe_claim_put_get(void);
+extern void test_pipe_claim_wrap(void);
+extern void test_pipe_claim_fail(void);
+extern void test_pipe_claim_wake_reader(void);
+extern void test_pipe_poll_data_available(void);
+
 /* k objects */
 extern struct k_pipe pipe, kpipe, khalfpipe, put_get_pipe;
 extern struct k_sem end_sema;
@@ -114,6 +120,11 @@ void test_main(void)
 			 ztest_unit_test(test_pipe_avail_w_lt_r),
 			 ztest_unit_test(test_pipe_avail_r_eq_w_full),
 			 ztest_unit_test(test_pipe_avail_r_eq_w_empty),
-			 ztest_unit_test(test_pipe_avail_no_buffer));
+			 ztest_unit_test(test_pipe_avail_no_buffer),
+			 ztest_unit_test(test_pipe_claim_put_get),
+			 ztest_unit_test(test_pipe_claim_wrap),
+			 ztest_unit_test(test_pipe_claim_fail),
+			 ztest_1cpu_unit_test(test_pipe_claim_wake_reader),
+			 ztest_unit_test(test_pipe_poll_data_available));
 	ztest_run_test_suite(pipe_api);
 }
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Tests for the in-place pipe claim / finish API
+ * @ingroup kernel_pipe_tests
+ * @{
+ */
+
+#include <ztest.h>
+#include <string.h>
+
+#define CLAIM_PIPE_SIZE 16
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+K_PIPE_DEFINE(claim_pipe, CLAIM_PIPE_SIZE, 4);
+
+static K_THREAD_STACK_DEFINE(claim_stack, STACK_SIZE);
+static struct k_thread claim_thread;
+static unsigned char rx_buf[CLAIM_PIPE_SIZE];
+
+static void claim_pipe_reset(void)
+{
+	claim_pipe.bytes_used = 0;
+	claim_pipe.read_index = 0;
+	claim_pipe.write_index = 0;
+}
+
+/**
+ * @brief Test claiming pipe buffer space for writing and reading in place
+ *
+ * @details Data committed with k_pipe_put_finish() must be visible to
+ * k_pipe_get(), and data written with k_pipe_put() must be readable through
+ * k_pipe_get_claim() without an intermediate copy.
+ *
+ * @see k_pipe_put_claim(), k_pipe_put_finish(), k_pipe_get_claim(),
+ * k_pipe_get_finish()
+ */
+void test_pipe_claim_put_get(void)
+{
+	uint8_t *ptr;
+	size_t len;
+	size_t read;
+
+	claim_pipe_reset();
+
+	len = k_pipe_put_claim(&claim_pipe, &ptr, 8);
+	zassert_equal(len, 8, NULL);
+	memcpy(ptr, "abcdefgh", 8);
+
+	/* only one write claim may be outstanding */
+	zassert_equal(k_pipe_put_claim(&claim_pipe, &ptr, 8), 0, NULL);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, len), 0, NULL);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 8, NULL);
+
+	zassert_equal(k_pipe_get(&claim_pipe, rx_buf, 8, &read, 8, K_NO_WAIT),
+		      0, NULL);
+	zassert_mem_equal(rx_buf, "abcdefgh", 8, NULL);
+
+	zassert_equal(k_pipe_put(&claim_pipe, "01234567", 8, &read, 8,
+				 K_NO_WAIT), 0, NULL);
+
+	len = k_pipe_get_claim(&claim_pipe, &ptr, CLAIM_PIPE_SIZE);
+	zassert_equal(len, 8, NULL);
+	zassert_mem_equal(ptr, "01234567", 8, NULL);
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &ptr, 1), 0, NULL);
+
+	/* a partial finish leaves the rest of the data in the pipe */
+	zassert_equal(k_pipe_get_finish(&claim_pipe, 3), 0, NULL);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 5, NULL);
+}
+
+/**
+ * @brief Test that claims stop at the end of the ring buffer
+ *
+ * @see k_pipe_put_claim(), k_pipe_get_claim()
+ */
+void test_pipe_claim_wrap(void)
+{
+	uint8_t *ptr;
+	size_t len;
+	size_t written;
+
+	claim_pipe_reset();
+
+	zassert_equal(k_pipe_put(&claim_pipe, rx_buf, 12, &written, 12,
+				 K_NO_WAIT), 0, NULL);
+	zassert_equal(k_pipe_get(&claim_pipe, rx_buf, 10, &written, 10,
+				 K_NO_WAIT), 0, NULL);
+
+	/* 14 bytes are free but only 4 are contiguous before the wrap */
+	len = k_pipe_put_claim(&claim_pipe, &ptr, CLAIM_PIPE_SIZE);
+	zassert_equal(len, 4, NULL);
+	zassert_equal(ptr, claim_pipe.buffer + 12, NULL);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, len), 0, NULL);
+
+	len = k_pipe_put_claim(&claim_pipe, &ptr, CLAIM_PIPE_SIZE);
+	zassert_equal(len, 10, NULL);
+	zassert_equal(ptr, claim_pipe.buffer, NULL);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, len), 0, NULL);
+	zassert_equal(k_pipe_write_avail(&claim_pipe), 0, NULL);
+
+	len = k_pipe_get_claim(&claim_pipe, &ptr, CLAIM_PIPE_SIZE);
+	zassert_equal(len, 6, NULL);
+	zassert_equal(k_pipe_get_finish(&claim_pipe, len), 0, NULL);
+
+	len = k_pipe_get_claim(&claim_pipe, &ptr, CLAIM_PIPE_SIZE);
+	zassert_equal(len, 10, NULL);
+	zassert_equal(k_pipe_get_finish(&claim_pipe, len), 0, NULL);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 0, NULL);
+}
+
+/**
+ * @brief Test finishing without a claim or beyond the claimed region
+ *
+ * @see k_pipe_put_finish(), k_pipe_get_finish()
+ */
+void test_pipe_claim_fail(void)
+{
+	uint8_t *ptr;
+	size_t len;
+
+	claim_pipe_reset();
+
+	zassert_equal(k_pipe_put_finish(&claim_pipe, 1), -EINVAL, NULL);
+	zassert_equal(k_pipe_get_finish(&claim_pipe, 1), -EINVAL, NULL);
+
+	/* nothing to read yet */
+	zassert_equal(k_pipe_get_claim(&claim_pipe, &ptr, 4), 0, NULL);
+
+	len = k_pipe_put_claim(&claim_pipe, &ptr, 4);
+	zassert_equal(len, 4, NULL);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, CLAIM_PIPE_SIZE + 1),
+		      -EINVAL, NULL);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, 0), 0, NULL);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 0, NULL);
+}
+
+static void claim_reader(void *p1, void *p2, void *p3)
+{
+	size_t read;
+
+	k_pipe_get(&claim_pipe, rx_buf, 4, &read, 4, K_FOREVER);
+}
+
+/**
+ * @brief Test that committing a claim wakes a pended reader
+ *
+ * @see k_pipe_put_finish()
+ */
+void test_pipe_claim_wake_reader(void)
+{
+	uint8_t *ptr;
+	size_t len;
+
+	claim_pipe_reset();
+	memset(rx_buf, 0, sizeof(rx_buf));
+
+	k_tid_t tid = k_thread_create(&claim_thread, claim_stack, STACK_SIZE,
+				      claim_reader, NULL, NULL, NULL,
+				      K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+
+	/* let the reader pend on the empty pipe */
+	k_msleep(10);
+
+	len = k_pipe_put_claim(&claim_pipe, &ptr, 6);
+	zassert_equal(len, 6, NULL);
+	memcpy(ptr, "wxyz12", 6);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, len), 0, NULL);
+
+	k_thread_join(tid, K_FOREVER);
+	zassert_mem_equal(rx_buf, "wxyz", 4, NULL);
+	zassert_equal(k_pipe_read_avail(&claim_pipe), 2, NULL);
+}
+
+/**
+ * @brief Test polling a pipe for data
+ *
+ * @see k_poll()
+ */
+void test_pipe_poll_data_available(void)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(
+		K_POLL_TYPE_PIPE_DATA_AVAILABLE, K_POLL_MODE_NOTIFY_ONLY,
+		&claim_pipe);
+	uint8_t *ptr;
+	size_t len;
+
+	claim_pipe_reset();
+
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN, NULL);
+
+	len = k_pipe_put_claim(&claim_pipe, &ptr, 1);
+	zassert_equal(len, 1, NULL);
+	zassert_equal(k_pipe_put_finish(&claim_pipe, len), 0, NULL);
+
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), 0, NULL);
+	zassert_equal(event.state, K_POLL_STATE_PIPE_DATA_AVAILABLE, NULL);
+}
+
+/**
+ * @}
+ */
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <ztest.h>
+
+#define NUM_SET_EVENTS 4
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+static struct k_sem set_sems[NUM_SET_EVENTS];
+static struct k_poll_event set_events[NUM_SET_EVENTS];
+static struct k_poll_set set;
+
+static K_THREAD_STACK_DEFINE(set_stack, STACK_SIZE);
+static struct k_thread set_thread;
+
+static void poll_set_setup(void)
+{
+	for (int i = 0; i < NUM_SET_EVENTS; i++) {
+		k_sem_init(&set_sems[i], 0, 1);
+		k_poll_event_init(&set_events[i], K_POLL_TYPE_SEM_AVAILABLE,
+				  K_POLL_MODE_NOTIFY_ONLY, &set_sems[i]);
+		set_events[i].tag = i;
+	}
+
+	k_poll_set_init(&set, set_events, NUM_SET_EVENTS);
+}
+
+/**
+ * @brief Test that a poll set reports only the signalled events
+ *
+ * @details Events stay registered across waits: an object signalled while
+ * no wait is in progress is reported by the next wait, and an event is
+ * reported again once it has been re-armed and its object is available.
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_init(), k_poll_set_wait(), k_poll_set_cleanup()
+ */
+void test_poll_set_ready_only(void)
+{
+	struct k_poll_event *ready[NUM_SET_EVENTS];
+	int rc;
+
+	poll_set_setup();
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SET_EVENTS, K_NO_WAIT),
+		      -EAGAIN, NULL);
+
+	/* signalled while registered, with no waiter */
+	k_sem_give(&set_sems[1]);
+	k_sem_give(&set_sems[3]);
+
+	rc = k_poll_set_wait(&set, ready, NUM_SET_EVENTS, K_NO_WAIT);
+	zassert_equal(rc, 2, "expected two ready events, got %d", rc);
+	zassert_equal(ready[0]->tag, 1, NULL);
+	zassert_equal(ready[1]->tag, 3, NULL);
+	zassert_equal(ready[0]->state, K_POLL_STATE_SEM_AVAILABLE, NULL);
+
+	/* still available, so re-arming reports the event again */
+	rc = k_poll_set_wait(&set, ready, 1, K_NO_WAIT);
+	zassert_equal(rc, 1, NULL);
+	zassert_equal(ready[0]->tag, 1, NULL);
+	zassert_equal(k_sem_take(&set_sems[1], K_NO_WAIT), 0, NULL);
+
+	/* the second event did not fit and is reported now */
+	rc = k_poll_set_wait(&set, ready, 1, K_NO_WAIT);
+	zassert_equal(rc, 1, NULL);
+	zassert_equal(ready[0]->tag, 3, NULL);
+	zassert_equal(k_sem_take(&set_sems[3], K_NO_WAIT), 0, NULL);
+
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SET_EVENTS, K_MSEC(10)),
+		      -EAGAIN, NULL);
+
+	k_poll_set_cleanup(&set);
+}
+
+static void set_giver(void *p1, void *p2, void *p3)
+{
+	k_sem_give(&set_sems[2]);
+}
+
+/**
+ * @brief Test that a poll set waiter is woken by a signalled event
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_wait()
+ */
+void test_poll_set_wait(void)
+{
+	struct k_poll_event *ready[NUM_SET_EVENTS];
+	int rc;
+
+	poll_set_setup();
+
+	/* arm all events before the giver runs */
+	zassert_equal(k_poll_set_wait(&set, ready, NUM_SET_EVENTS, K_NO_WAIT),
+		      -EAGAIN, NULL);
+
+	k_thread_create(&set_thread, set_stack, STACK_SIZE, set_giver,
+			NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0,
+			K_NO_WAIT);
+
+	rc = k_poll_set_wait(&set, ready, NUM_SET_EVENTS, K_FOREVER);
+	zassert_equal(rc, 1, NULL);
+	zassert_equal(ready[0]->tag, 2, NULL);
+	zassert_equal(k_sem_take(&set_sems[2], K_NO_WAIT), 0, NULL);
+
+	k_thread_join(&set_thread, K_FOREVER);
+	k_poll_set_cleanup(&set);
+
+	/* after cleanup the objects no longer reference the events */
+	for (int i = 0; i < NUM_SET_EVENTS; i++) {
+		zassert_true(sys_dlist_is_empty(&set_sems[i].poll_events),
+			     NULL);
+	}
+}
@@ -211,11 +211,16 @@ void test_unqueued(void)
 	}
 }
 
+extern void test_reservation_admission(void);
+extern void test_reservation_overload(void);
+
 void test_main(void)
 {
 	ztest_test_suite(suite_deadline,
 			 ztest_unit_test(test_deadline),
 			 ztest_unit_test(test_yield),
-			 ztest_unit_test(test_unqueued));
+			 ztest_unit_test(test_unqueued),
+			 ztest_unit_test(test_reservation_admission),
+			 ztest_unit_test(test_reservation_overload));
 	ztest_run_test_suite(suite_deadline);
 }
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr.h>
+#include <ztest.h>
+
+#define STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACKSIZE)
+
+#define PERIOD_US 100000
+#define RUNTIME_US 20000
+#define N_JOBS 5
+
+#ifdef CONFIG_SCHED_DEADLINE_RESERVATION
+static struct k_thread res_threads[3];
+static K_THREAD_STACK_ARRAY_DEFINE(res_stacks, 3, STACK_SIZE);
+
+static void res_worker(void *p1, void *p2, void *p3)
+{
+	uint32_t work_us = POINTER_TO_UINT(p1);
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	for (int i = 0; i < N_JOBS; i++) {
+		k_busy_wait(work_us);
+		(void)k_thread_reservation_wait_next();
+	}
+}
+
+static k_tid_t res_thread_create(int i, uint32_t work_us, k_timeout_t delay)
+{
+	return k_thread_create(&res_threads[i], res_stacks[i], STACK_SIZE,
+			       res_worker, UINT_TO_POINTER(work_us), NULL,
+			       NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0,
+			       delay);
+}
+#endif
+
+/**
+ * @brief Test the admission control of deadline reservations
+ *
+ * @details Reservations are granted until their total utilization would
+ * exceed CONFIG_SCHED_DEADLINE_MAX_UTILIZATION, and released when the
+ * threads exit.
+ */
+void test_reservation_admission(void)
+{
+#ifdef CONFIG_SCHED_DEADLINE_RESERVATION
+	k_tid_t tids[3];
+
+	for (int i = 0; i < 3; i++) {
+		tids[i] = res_thread_create(i, 0, K_FOREVER);
+	}
+
+	zassert_equal(k_thread_reservation_set(tids[0], 2, 1), -EINVAL,
+		      "runtime longer than the period accepted");
+
+	zassert_equal(k_thread_reservation_set(tids[0], 40, 100), 0, NULL);
+	zassert_equal(k_thread_reservation_set(tids[1], 40, 100), 0, NULL);
+	zassert_equal(k_thread_reservation_set(tids[2], 40, 100), -EBUSY,
+		      "utilization over the limit accepted");
+	zassert_equal(k_thread_reservation_set(tids[2], 5, 100), 0, NULL);
+
+	/* Releasing makes room again */
+	zassert_equal(k_thread_reservation_set(tids[1], 0, 0), 0, NULL);
+	zassert_equal(k_thread_reservation_set(tids[2], 40, 100), 0, NULL);
+
+	for (int i = 0; i < 3; i++) {
+		k_thread_abort(tids[i]);
+	}
+
+	/* Aborted threads released their reservations */
+	tids[0] = res_thread_create(0, 0, K_FOREVER);
+	zassert_equal(k_thread_reservation_set(tids[0], 80, 100), 0, NULL);
+	k_thread_abort(tids[0]);
+#else
+	ztest_test_skip();
+#endif
+}
+
+/**
+ * @brief Test deadline misses under overload
+ *
+ * @details Two threads have the same reservation, one works within it
+ * while the other works for longer than its period at every job. The
+ * overloaded thread overruns its budget and misses its deadlines, while
+ * the budget enforcement keeps the other one from missing any.
+ */
+void test_reservation_overload(void)
+{
+#ifdef CONFIG_SCHED_DEADLINE_RESERVATION
+	struct k_thread_reservation_stats good, bad;
+	k_tid_t good_tid, bad_tid;
+
+	good_tid = res_thread_create(0, RUNTIME_US / 2, K_FOREVER);
+	bad_tid = res_thread_create(1, PERIOD_US + PERIOD_US / 2, K_FOREVER);
+
+	zassert_equal(k_thread_reservation_set(good_tid, RUNTIME_US,
+					       PERIOD_US), 0, NULL);
+	zassert_equal(k_thread_reservation_set(bad_tid, RUNTIME_US,
+					       PERIOD_US), 0, NULL);
+
+	k_thread_start(bad_tid);
+	k_thread_start(good_tid);
+
+	k_thread_join(good_tid, K_FOREVER);
+	k_thread_join(bad_tid, K_FOREVER);
+
+	k_thread_reservation_stats_get(good_tid, &good);
+	k_thread_reservation_stats_get(bad_tid, &bad);
+
+	TC_PRINT("within budget: %u jobs, %u misses, %u overruns\n",
+		 good.jobs, good.misses, good.overruns);
+	TC_PRINT("overloaded: %u jobs, %u misses, %u overruns\n",
+		 bad.jobs, bad.misses, bad.overruns);
+
+	zassert_equal(good.jobs, N_JOBS, NULL);
+	zassert_equal(good.misses, 0, "deadline missed within budget");
+	zassert_equal(good.overruns, 0, "budget overrun within budget");
+	zassert_equal(bad.jobs, N_JOBS, NULL);
+	zassert_equal(bad.misses, N_JOBS, "overloaded jobs met deadlines");
+	zassert_true(bad.overruns > 0U, "budget not enforced");
+#else
+	ztest_test_skip();
+#endif
+}
@@ -948,6 +948,61 @@ void test_inc_concurrency(void)
 			"total count %d is wrong(M)", global_cnt);
 }
 
+#ifdef CONFIG_ADAPTIVE_SPIN
+static volatile bool spin_owner_locked;
+
+static void spin_owner_entry(void *p1, void *p2, void *p3)
+{
+	k_mutex_lock(&smutex, K_FOREVER);
+	spin_owner_locked = true;
+
+	/* Hold the mutex, running, well past the spin time */
+	k_busy_wait(100 * CONFIG_ADAPTIVE_SPIN_MAX_US);
+
+	k_mutex_unlock(&smutex);
+}
+#endif
+
+/**
+ * @brief Test adaptive spinning on a mutex owned from another CPU
+ *
+ * @ingroup kernel_smp_tests
+ *
+ * @details A thread locks a mutex and keeps running on the other CPU for
+ * longer than the spin time. Locking the mutex from this CPU shall spin
+ * once, miss, then pend until the mutex is released.
+ */
+void test_adaptive_spin(void)
+{
+#ifdef CONFIG_ADAPTIVE_SPIN
+	struct k_adaptive_spin_stats before, after;
+
+	k_mutex_init(&smutex);
+	spin_owner_locked = false;
+	k_adaptive_spin_stats_get(&before);
+
+	k_tid_t tid = k_thread_create(&t2, t2_stack, T2_STACK_SIZE,
+				      spin_owner_entry, NULL, NULL, NULL,
+				      K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+
+	/* Busy wait so that the owner runs on the other CPU */
+	while (!spin_owner_locked) {
+	}
+
+	zassert_equal(k_mutex_lock(&smutex, K_FOREVER), 0, "lock failed");
+	k_mutex_unlock(&smutex);
+	k_thread_join(tid, K_FOREVER);
+
+	k_adaptive_spin_stats_get(&after);
+	zassert_equal(after.mutex_misses, before.mutex_misses + 1,
+		      "the spin should have missed once");
+	zassert_equal(after.mutex_hits, before.mutex_hits,
+		      "the spin should not have hit");
+#else
+	ztest_test_skip();
+#endif
+}
+
 void test_main(void)
 {
 	/* Sleep a bit to guarantee that both CPUs enter an idle
@@ -969,7 +1024,8 @@ void test_main(void)
 			 ztest_unit_test(test_fatal_on_smp),
 			 ztest_unit_test(test_workq_on_smp),
 			 ztest_unit_test(test_smp_release_global_lock),
-			 ztest_unit_test(test_inc_concurrency)
+			 ztest_unit_test(test_inc_concurrency),
+			 ztest_unit_test(test_adaptive_spin)
 			 );
 	ztest_run_test_suite(smp);
 }
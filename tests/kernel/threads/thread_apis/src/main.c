@@ -582,6 +582,66 @@ void test_k_busy_wait(void)
 	cycles = test_stats.execution_cycles;
 }
 
+#ifdef CONFIG_SCHED_THREAD_STATS
+static K_SEM_DEFINE(sched_stats_sem, 0, 1);
+
+static void sched_stats_entry(void *p1, void *p2, void *p3)
+{
+	k_sem_take(&sched_stats_sem, K_FOREVER);
+}
+#endif
+
+/**
+ * @brief Test the scheduling statistics
+ *
+ * @details A higher priority thread is started, then woken up once. Both
+ * wakeups shall be counted in its latency histogram, and the run queue and
+ * CPU statistics shall show activity.
+ */
+void test_thread_sched_stats(void)
+{
+#ifdef CONFIG_SCHED_THREAD_STATS
+	struct k_thread_sched_stats stats;
+	struct k_cpu_sched_stats cpu_stats;
+	struct k_sched_runq_stats runq_stats;
+	uint32_t wakeups = 0U;
+
+	/* Check NULL parameters */
+	zassert_equal(k_thread_sched_stats_get(NULL, &stats), -EINVAL, NULL);
+	zassert_equal(k_thread_sched_stats_get(k_current_get(), NULL),
+		      -EINVAL, NULL);
+	zassert_equal(k_cpu_sched_stats_get(CONFIG_MP_NUM_CPUS, &cpu_stats),
+		      -EINVAL, NULL);
+	zassert_equal(k_sched_runq_stats_get(NULL), -EINVAL, NULL);
+
+	k_tid_t tid = k_thread_create(&tdata, tstack, STACK_SIZE,
+				      sched_stats_entry, NULL, NULL, NULL,
+				      k_thread_priority_get(k_current_get()) - 1,
+				      0, K_NO_WAIT);
+
+	/* Let it run and pend on the semaphore, then wake it up */
+	k_msleep(10);
+	k_sem_give(&sched_stats_sem);
+	k_thread_join(tid, K_FOREVER);
+
+	zassert_equal(k_thread_sched_stats_get(tid, &stats), 0, NULL);
+	zassert_equal(stats.switches, 2, "switches %u", stats.switches);
+	for (int i = 0; i < CONFIG_SCHED_THREAD_STATS_HIST_BUCKETS; i++) {
+		wakeups += stats.wakeup_hist[i];
+	}
+	zassert_equal(wakeups, 2, "wakeups %u", wakeups);
+
+	zassert_equal(k_cpu_sched_stats_get(0, &cpu_stats), 0, NULL);
+	zassert_true(cpu_stats.switches >= 4U, NULL);
+	zassert_true(cpu_stats.busy_cycles > 0U, NULL);
+
+	zassert_equal(k_sched_runq_stats_get(&runq_stats), 0, NULL);
+	zassert_true(runq_stats.max_depth >= 1U, NULL);
+#else
+	ztest_test_skip();
+#endif
+}
+
 static void tp_entry(void *p1, void *p2, void *p3)
 {
 	tp = 100;
@@ -696,6 +756,7 @@ void test_main(void)
 			 ztest_unit_test(test_abort_from_isr_not_self),
 			 ztest_user_unit_test(test_thread_timeout_remaining_expires),
 			 ztest_unit_test(test_k_busy_wait),
+			 ztest_1cpu_unit_test(test_thread_sched_stats),
 			 ztest_1cpu_user_unit_test(test_k_busy_wait_user)
 			 );
 
@@ -1512,6 +1512,178 @@ static void test_1cpu_legacy_delayed_cancel(void)
 }
 
 
+#ifdef CONFIG_WORKQUEUE_POOL
+
+#define POOL_THREADS 2
+
+static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks, POOL_THREADS, STACK_SIZE);
+static struct k_thread pool_threads[POOL_THREADS - 1];
+static struct k_work_q pool_queue;
+
+/* Released by the test to let pool handlers complete. */
+static K_SEM_DEFINE(pool_rel_sem, 0, POOL_THREADS);
+
+/* Number of pool handlers running, and the most seen at once. */
+static atomic_t pool_active;
+static atomic_t pool_active_max;
+static atomic_t pool_ctr;
+
+static struct k_work pool_work[POOL_THREADS];
+
+static void pool_handler(struct k_work *work)
+{
+	atomic_val_t active = atomic_inc(&pool_active) + 1;
+
+	if (active > atomic_get(&pool_active_max)) {
+		atomic_set(&pool_active_max, active);
+	}
+
+	(void)k_sem_take(&pool_rel_sem, K_FOREVER);
+	atomic_dec(&pool_active);
+	atomic_inc(&pool_ctr);
+}
+
+static void pool_release_cb(struct k_timer *timer)
+{
+	for (int i = 0; i < POOL_THREADS; i++) {
+		k_sem_give(&pool_rel_sem);
+	}
+}
+
+static K_TIMER_DEFINE(pool_releaser, pool_release_cb, NULL);
+
+static inline void reset_pool(void)
+{
+	k_sem_reset(&pool_rel_sem);
+	atomic_set(&pool_active, 0);
+	atomic_set(&pool_active_max, 0);
+	atomic_set(&pool_ctr, 0);
+	for (int i = 0; i < POOL_THREADS; i++) {
+		k_work_init(&pool_work[i], pool_handler);
+	}
+}
+
+/* Start a work queue served by a pool of threads. */
+static void test_pool_start(void)
+{
+	struct k_work_queue_config cfg = {
+		.name = "wq.pool",
+	};
+
+	zassert_equal(pool_queue.flags, 0, NULL);
+	k_work_queue_pool_start(&pool_queue, pool_stacks[0], STACK_SIZE,
+				pool_threads, POOL_THREADS,
+				COOPHI_PRIORITY, &cfg);
+	zassert_equal(pool_queue.flags, K_WORK_QUEUE_STARTED, NULL);
+	zassert_equal(k_work_queue_thread_get(&pool_queue),
+		      &pool_queue.thread, NULL);
+}
+
+/* Independent items run concurrently on different pool threads. */
+static void test_pool_parallel(void)
+{
+	int rc;
+
+	reset_pool();
+
+	for (int i = 0; i < POOL_THREADS; i++) {
+		rc = k_work_submit_to_queue(&pool_queue, &pool_work[i]);
+		zassert_equal(rc, 1, NULL);
+	}
+
+	/* Let the pool threads pick up the items. */
+	k_sleep(K_TICKS(1));
+	for (int i = 0; i < POOL_THREADS; i++) {
+		zassert_equal(k_work_busy_get(&pool_work[i]), K_WORK_RUNNING,
+			      NULL);
+	}
+	zassert_equal(atomic_get(&pool_active), POOL_THREADS, NULL);
+
+	k_timer_start(&pool_releaser, K_TICKS(1), K_NO_WAIT);
+	rc = k_work_queue_drain(&pool_queue, false);
+	zassert_equal(rc, 1, NULL);
+
+	zassert_equal(atomic_get(&pool_ctr), POOL_THREADS, NULL);
+	zassert_equal(atomic_get(&pool_active_max), POOL_THREADS, NULL);
+}
+
+/* An item resubmitted while running is not started by another pool
+ * thread until it completes.
+ */
+static void test_pool_no_reentry(void)
+{
+	int rc;
+
+	reset_pool();
+
+	rc = k_work_submit_to_queue(&pool_queue, &pool_work[0]);
+	zassert_equal(rc, 1, NULL);
+	k_sleep(K_TICKS(1));
+	zassert_equal(k_work_busy_get(&pool_work[0]), K_WORK_RUNNING, NULL);
+
+	/* Resubmission goes to the same queue, and stays queued even
+	 * though an idle pool thread is available.
+	 */
+	rc = k_work_submit_to_queue(&pool_queue, &pool_work[0]);
+	zassert_equal(rc, 2, NULL);
+	k_sleep(K_TICKS(1));
+	zassert_equal(k_work_busy_get(&pool_work[0]),
+		      K_WORK_RUNNING | K_WORK_QUEUED, NULL);
+	zassert_equal(atomic_get(&pool_active), 1, NULL);
+
+	k_timer_start(&pool_releaser, K_TICKS(1), K_NO_WAIT);
+	rc = k_work_queue_drain(&pool_queue, false);
+	zassert_equal(rc, 1, NULL);
+
+	zassert_equal(atomic_get(&pool_ctr), 2, NULL);
+	zassert_equal(atomic_get(&pool_active_max), 1, NULL);
+}
+
+/* Flushing an item running on a pool thread waits for its handler
+ * even though another pool thread is idle.
+ */
+static void test_pool_running_flush(void)
+{
+	int rc;
+
+	reset_pool();
+
+	rc = k_work_submit_to_queue(&pool_queue, &pool_work[0]);
+	zassert_equal(rc, 1, NULL);
+	k_sleep(K_TICKS(1));
+	zassert_equal(k_work_busy_get(&pool_work[0]), K_WORK_RUNNING, NULL);
+
+	k_timer_start(&pool_releaser, K_TICKS(1), K_NO_WAIT);
+	zassert_true(k_work_flush(&pool_work[0], &work_sync), NULL);
+
+	zassert_equal(atomic_get(&pool_ctr), 1, NULL);
+	zassert_equal(k_work_busy_get(&pool_work[0]), 0, NULL);
+}
+
+#else /* CONFIG_WORKQUEUE_POOL */
+
+static void test_pool_start(void)
+{
+	ztest_test_skip();
+}
+
+static void test_pool_parallel(void)
+{
+	ztest_test_skip();
+}
+
+static void test_pool_no_reentry(void)
+{
+	ztest_test_skip();
+}
+
+static void test_pool_running_flush(void)
+{
+	ztest_test_skip();
+}
+
+#endif /* CONFIG_WORKQUEUE_POOL */
+
 static void test_nop(void)
 {
 	ztest_test_skip();
@@ -1561,6 +1733,10 @@ void test_main(void)
 			 ztest_1cpu_unit_test(
 				 test_1cpu_legacy_delayed_resubmit),
 			 ztest_1cpu_unit_test(test_1cpu_legacy_delayed_cancel),
+			 ztest_unit_test(test_pool_start),
+			 ztest_1cpu_unit_test(test_pool_parallel),
+			 ztest_1cpu_unit_test(test_pool_no_reentry),
+			 ztest_1cpu_unit_test(test_pool_running_flush),
 			 ztest_unit_test(test_nop));
 	ztest_run_test_suite(work);
 }
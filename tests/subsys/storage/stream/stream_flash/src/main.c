@@ -464,6 +464,137 @@ static void test_stream_flash_buffered_write_whole_page(void)
 }
 #endif
 
+#ifdef CONFIG_STREAM_FLASH_ERASE_AHEAD
+static void test_stream_flash_erase_ahead(void)
+{
+	int rc;
+
+	init_target();
+
+	/* Fill the pages following the first one, they must get erased */
+	rc = flash_write(fdev, FLASH_BASE + page_size, write_buf,
+			 page_size * 3);
+	zassert_equal(rc, 0, "should succeed");
+
+	rc = stream_flash_erase_ahead(&ctx, 2);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN, false);
+	zassert_equal(rc, 0, "expected success");
+
+	/* Let the erase ahead thread run */
+	k_sleep(K_MSEC(100));
+
+	VERIFY_WRITTEN(0, BUF_LEN);
+	VERIFY_ERASED(page_size, page_size * 2);
+	/* Not further than asked */
+	VERIFY_WRITTEN(page_size * 3, page_size);
+
+	/* The pages erased ahead are not erased again when written */
+	rc = stream_flash_buffered_write(&ctx, write_buf, page_size * 2, true);
+	zassert_equal(rc, 0, "expected success");
+
+	VERIFY_WRITTEN(0, page_size * 2 + BUF_LEN);
+
+	rc = stream_flash_erase_ahead(&ctx, 0);
+	zassert_equal(rc, 0, "expected success");
+}
+
+/* Erasing ahead goes past a page erased by stream_flash_erase_page() */
+static void test_stream_flash_erase_ahead_after_erase_page(void)
+{
+	int rc;
+
+	init_target();
+
+	rc = flash_write(fdev, FLASH_BASE + page_size, write_buf,
+			 page_size * 3);
+	zassert_equal(rc, 0, "should succeed");
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN, false);
+	zassert_equal(rc, 0, "expected success");
+
+	/* The page following the erased range the writes are in */
+	rc = stream_flash_erase_page(&ctx, FLASH_BASE + page_size);
+	zassert_equal(rc, 0, "expected success");
+
+	rc = stream_flash_erase_ahead(&ctx, 2);
+	zassert_equal(rc, 0, "expected success");
+
+	/* Let the erase ahead thread run */
+	k_sleep(K_MSEC(100));
+
+	VERIFY_WRITTEN(0, BUF_LEN);
+	VERIFY_ERASED(page_size, page_size * 2);
+	VERIFY_WRITTEN(page_size * 3, page_size);
+
+	/* Waits for the erase ahead work, which must have stopped */
+	rc = stream_flash_erase_ahead(&ctx, 0);
+	zassert_equal(rc, 0, "expected success");
+}
+#else
+static void test_stream_flash_erase_ahead(void)
+{
+	ztest_test_skip();
+}
+
+static void test_stream_flash_erase_ahead_after_erase_page(void)
+{
+	ztest_test_skip();
+}
+#endif
+
+#ifdef CONFIG_STREAM_FLASH_WRITE_COALESCE
+static int write_calls;
+
+static int counting_write(const struct device *dev, off_t off,
+			  const void *data, size_t len)
+{
+	write_calls++;
+
+	return api->write(dev, off, data, len);
+}
+
+static void test_stream_flash_buffered_write_coalesce(void)
+{
+	int rc;
+	struct device fake_dev = *fdev;
+	struct flash_driver_api fake_api = *api;
+
+	init_target();
+
+	fake_api.write = counting_write;
+	fake_dev.api = &fake_api;
+
+	/* Without verification callback */
+	rc = stream_flash_init(&ctx, &fake_dev, buf, BUF_LEN, FLASH_BASE, 0,
+			       NULL);
+	zassert_equal(rc, 0, "expected success");
+
+	write_calls = 0;
+
+	/* Whole buffers are programmed at once, the rest is buffered */
+	rc = stream_flash_buffered_write(&ctx, write_buf, BUF_LEN * 3 + 128,
+					 false);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(write_calls, 1, "expected a single write");
+	zassert_equal(stream_flash_bytes_written(&ctx), BUF_LEN * 3,
+		      "expected whole buffers to be written");
+	zassert_equal(ctx.buf_bytes, 128, "expected rest to be buffered");
+	VERIFY_WRITTEN(0, BUF_LEN * 3);
+
+	rc = stream_flash_buffered_write(&ctx, write_buf, 0, true);
+	zassert_equal(rc, 0, "expected success");
+	zassert_equal(write_calls, 2, "expected the flush to write");
+	VERIFY_WRITTEN(0, BUF_LEN * 3 + 128);
+}
+#else
+static void test_stream_flash_buffered_write_coalesce(void)
+{
+	ztest_test_skip();
+}
+#endif
+
 static size_t write_and_save_progress(size_t bytes, const char *save_key)
 {
 	int rc;
@@ -664,6 +795,9 @@ void test_main(void)
 	     ztest_unit_test(test_stream_flash_flush),
 	     ztest_unit_test(test_stream_flash_buffered_write_whole_page),
 	     ztest_unit_test(test_stream_flash_erase_page),
+	     ztest_unit_test(test_stream_flash_erase_ahead),
+	     ztest_unit_test(test_stream_flash_erase_ahead_after_erase_page),
+	     ztest_unit_test(test_stream_flash_buffered_write_coalesce),
 	     ztest_unit_test(test_stream_flash_bytes_written),
 	     ztest_unit_test(test_stream_flash_progress_api),
 	     ztest_unit_test(test_stream_flash_progress_resume),
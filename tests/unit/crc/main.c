@@ -229,6 +229,29 @@ void test_crc8(void)
 	zassert_equal(fcs, expected, "0x%02x vs 0x%02x", fcs, expected);
 }
 
+void test_crc_large_buffer(void)
+{
+	static uint8_t buf[1031];
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = i & 0xff;
+	}
+
+	/* Start at an odd offset so word based implementations see an
+	 * unaligned head and a partial tail.
+	 */
+	zassert_equal(crc32_ieee(&buf[1], sizeof(buf) - 1), 0xC4448463, NULL);
+	zassert_equal(crc32_c(0, &buf[1], sizeof(buf) - 1, true, true),
+		      0xB47685C8, NULL);
+	zassert_equal(crc32_c(crc32_c(0, &buf[1], 500, true, false),
+			      &buf[501], sizeof(buf) - 501, false, true),
+		      0xB47685C8, NULL);
+	zassert_equal(crc16_ccitt(0, &buf[1], sizeof(buf) - 1), 0x31A5, NULL);
+	zassert_equal(crc16_itu_t(0, &buf[1], sizeof(buf) - 1), 0x44C2, NULL);
+	zassert_equal(crc8_ccitt(CRC8_CCITT_INITIAL_VALUE, &buf[1],
+				 sizeof(buf) - 1), 0x75, NULL);
+}
+
 void test_main(void)
 {
 	ztest_test_suite(test_crc,
@@ -241,6 +264,7 @@ void test_main(void)
 			 ztest_unit_test(test_crc16_itu_t),
 			 ztest_unit_test(test_crc8_ccitt),
 			 ztest_unit_test(test_crc7_be),
-			 ztest_unit_test(test_crc8));
+			 ztest_unit_test(test_crc8),
+			 ztest_unit_test(test_crc_large_buffer));
 	ztest_run_test_suite(test_crc);
 }
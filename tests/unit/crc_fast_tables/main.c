@@ -0,0 +1,10 @@
+/*
+ * Copyright (c) 2021 Intel Corporation
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/* Run the CRC test suite against the byte and slicing-by-8 tables. */
+#define CONFIG_CRC_FAST_TABLES 1
+
+#include "../crc/main.c"